@@ -0,0 +1,55 @@
+/**
+ * @file Core/Basic/Symbol.cpp
+ * Contains the implementation of class Core::Basic::SymbolTable.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Basic
+{
+
+//==============================================================================
+// Member Functions
+
+Str const* SymbolTable::intern(Char const *str)
+{
+  if (str == 0) str = S("");
+  std::lock_guard<std::mutex> lock(this->mutex);
+  auto iter = this->strs.find(Str(true, str));
+  if (iter == this->strs.end()) iter = this->strs.insert(Str(str)).first;
+  return &*iter;
+}
+
+
+Str const* SymbolTable::find(Char const *str)
+{
+  if (str == 0) str = S("");
+  std::lock_guard<std::mutex> lock(this->mutex);
+  auto iter = this->strs.find(Str(true, str));
+  return iter == this->strs.end() ? 0 : &*iter;
+}
+
+
+SymbolTable* SymbolTable::getSingleton()
+{
+  // Symbols can be created from multiple threads, so the pointer is a function local static, which is guaranteed to be
+  // initialized only once even if multiple threads reach it at the same time.
+  static SymbolTable *symbolTable = []() {
+    auto table = reinterpret_cast<SymbolTable*>(GLOBAL_STORAGE->getObject(S("Core::Basic::SymbolTable")));
+    if (table == 0) {
+      table = new SymbolTable;
+      GLOBAL_STORAGE->setObject(S("Core::Basic::SymbolTable"), reinterpret_cast<void*>(table));
+    }
+    return table;
+  }();
+  return symbolTable;
+}
+
+} // namespace
@@ -0,0 +1,168 @@
+/**
+ * @file Core/Basic/Symbol.h
+ * Contains the header of classes Core::Basic::Symbol and Core::Basic::SymbolTable.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_BASIC_SYMBOL_H
+#define CORE_BASIC_SYMBOL_H
+
+namespace Core::Basic
+{
+
+/**
+ * @brief A global table of interned strings.
+ * @ingroup basic_utils
+ *
+ * Each distinct string is stored once in this table and is never released, so
+ * pointers to the stored strings remain valid and unique for the lifetime of
+ * the process. The table is shared among all libraries and is safe to use from
+ * multiple threads.
+ *
+ * Since entries are never released, only strings from a bounded set, like
+ * grammar texts and definition names, should be interned. Arbitrary texts,
+ * like those of source code tokens, should be checked with find, which
+ * doesn't add to the table.
+ */
+class SymbolTable
+{
+  //============================================================================
+  // Member Variables
+
+  private: std::unordered_set<Str, std::hash<Str>> strs;
+  private: std::mutex mutex;
+
+
+  //============================================================================
+  // Constructor
+
+  /// Prevent the singleton class from being inistantiated.
+  private: SymbolTable()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Get the unique stored copy of the given string, adding it to the table if needed.
+  public: Str const* intern(Char const *str);
+
+  /// Get the stored copy of the given string without adding it, or 0 if it's not in the table.
+  public: Str const* find(Char const *str);
+
+  /// Get the singleton object.
+  public: static SymbolTable* getSingleton();
+
+}; // class
+
+
+/**
+ * @brief A pointer sized handle to an interned string.
+ * @ingroup basic_utils
+ *
+ * Two symbols are equal if and only if their strings are equal, so comparing
+ * and hashing symbols is done on the pointers without touching the strings.
+ * Creating a symbol from a string requires a lookup in the global symbol
+ * table, so symbols pay off when they are created once and compared many
+ * times.
+ */
+class Symbol
+{
+  //============================================================================
+  // Member Variables
+
+  private: Str const *str;
+
+
+  //============================================================================
+  // Constructors
+
+  public: Symbol() : str(0)
+  {
+  }
+
+  public: explicit Symbol(Char const *s) : str(SymbolTable::getSingleton()->intern(s))
+  {
+  }
+
+  private: explicit Symbol(Str const *s) : str(s)
+  {
+  }
+
+
+  //============================================================================
+  // Static Functions
+
+  /**
+   * @brief Get the symbol of a string without interning it.
+   * Returns a null symbol if the string isn't interned yet, in which case it
+   * isn't equal to any existing symbol.
+   */
+  public: static Symbol find(Char const *s)
+  {
+    return Symbol(SymbolTable::getSingleton()->find(s));
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: Bool isNull() const
+  {
+    return this->str == 0;
+  }
+
+  public: Str const& getStr() const
+  {
+    static Str empty;
+    return this->str == 0 ? empty : *this->str;
+  }
+
+  public: Char const* getBuf() const
+  {
+    return this->getStr().getBuf();
+  }
+
+
+  //============================================================================
+  // Operators
+
+  public: Bool operator==(Symbol const &s) const
+  {
+    return this->str == s.str;
+  }
+
+  public: Bool operator!=(Symbol const &s) const
+  {
+    return this->str != s.str;
+  }
+
+  friend struct std::hash<Symbol>;
+
+}; // class
+
+} // namespace
+
+
+//==============================================================================
+// std::hash specialization for Symbol.
+
+namespace std
+{
+  template<> struct hash<Core::Basic::Symbol>
+  {
+    std::size_t operator()(Core::Basic::Symbol const &s) const noexcept
+    {
+      return std::hash<Core::Basic::Str const*>{}(s.str);
+    }
+  };
+}
+
+#endif
@@ -51,7 +51,7 @@ template<class RT, class ...ARGS> class Slot
 
   public: ~Slot()
   {
-    for (auto signal : this->signals) signal->disconnect(*this);
+    this->disconnect();
   }
 
 
@@ -78,8 +78,12 @@ template<class RT, class ...ARGS> class Slot
 
   public: void disconnect()
   {
-    for (auto signal : this->signals) signal->disconnect(*this);
-    this->signals.clear();
+    // Disconnecting from a signal removes it from our list, so we can't iterate over the list directly.
+    while (this->signals.size() > 0) {
+      auto signal = this->signals.back();
+      this->signals.pop_back();
+      signal->disconnect(*this);
+    }
   }
 
   public: void init(RT(*f)(ARGS...))
@@ -107,6 +111,11 @@ template<class RT, class ...ARGS> class Slot
     return (Bool)this->func;
   }
 
+  public: Bool isConnected() const
+  {
+    return this->signals.size() > 0;
+  }
+
   public: RT call(ARGS... args)
   {
     return this->func(args...);
@@ -171,7 +180,17 @@ template<class RT, class ...ARGS> class _Signal
 
   public: virtual void connect(Slot<RT, ARGS...> &slot)
   {
-    for (auto s : this->slotsEntries) if (s.slot == &slot) return;
+    for (auto &s : this->slotsEntries) {
+      if (s.slot == &slot) {
+        if (!s.enabled) {
+          // The slot was disconnected while firing and is pending removal.
+          s.enabled = true;
+          slot.removeSignal(this);
+          slot.addSignal(this);
+        }
+        return;
+      }
+    }
     this->slotsEntries.push_back(&slot);
     slot.addSignal(this);
   }
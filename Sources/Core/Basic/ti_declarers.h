@@ -147,8 +147,16 @@
                _CUSTOM_NAME_TYPE_INFO_WITH_INTERFACES, \
                _CUSTOM_NAME_TYPE_INFO, _, _, _, _, _)(__VA_ARGS__)
 
+/**
+ * @brief Defines an object factory for the type.
+ *
+ * Types with object factories also get their type info registered in the
+ * global storage at load time so that they can be looked up by their unique
+ * names before any object of the type is created.
+ */
 #define OBJECT_FACTORY(myType) \
-  private: static TiObjectFactory* _getFactory(Int dummy) { return getTiObjectFactory<myType>(); }
+  private: static TiObjectFactory* _getFactory(Int dummy) { return getTiObjectFactory<myType>(); } \
+  private: static inline Bool _typeInfoRegistered = (myType::getTypeInfo() != 0);
 
 
 //==============================================================================
@@ -15,6 +15,26 @@
 namespace Core::Data::Ast
 {
 
+//==============================================================================
+// Member Functions
+
+void Definition::setName(Char const *n)
+{
+  this->name = n;
+  // The owning scope indexes its definitions by name.
+  auto scope = ti_cast<Scope>(this->getOwner());
+  if (scope != 0) scope->onDefinitionChanged(this, true);
+}
+
+
+void Definition::setTarget(TioSharedPtr const &t)
+{
+  UPDATE_OWNED_SHAREDPTR(this->target, t);
+  auto scope = ti_cast<Scope>(this->getOwner());
+  if (scope != 0) scope->onDefinitionChanged(this, false);
+}
+
+
 //==============================================================================
 // Printable Implementation
 
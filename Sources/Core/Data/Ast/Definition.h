@@ -33,6 +33,12 @@ class Definition : public Node,
   // Member Variables
 
   private: TiStr name;
+
+  /// The interned symbol of name, set on demand by getNameSymbol.
+  private: mutable Symbol nameSymbol;
+
+  /// A copy of name at the time nameSymbol was interned, used to detect direct writes to name.
+  private: mutable Str nameSymbolStr;
   private: TioSharedPtr target;
   private: TiBool toMerge;
   private: SharedPtr<List> modifiers;
@@ -74,13 +80,10 @@ class Definition : public Node,
   //============================================================================
   // Member Functions
 
-  public: void setName(Char const *n)
-  {
-    this->name = n;
-  }
+  public: void setName(Char const *n);
   public: void setName(TiStr const *n)
   {
-    this->name = n == 0 ? "" : n->get();
+    this->setName(n == 0 ? S("") : n->get());
   }
 
   public: TiStr const& getName() const
@@ -88,10 +91,22 @@ class Definition : public Node,
     return this->name;
   }
 
-  public: void setTarget(TioSharedPtr const &t)
+  /**
+   * @brief Get the interned symbol of the name.
+   *
+   * Definition names are interned so that identifiers can be matched against
+   * them by symbol.
+   */
+  public: Symbol const& getNameSymbol() const
   {
-    UPDATE_OWNED_SHAREDPTR(this->target, t);
+    if (this->nameSymbol.isNull() || this->name.getStr().getBuf() != this->nameSymbolStr.getBuf()) {
+      this->nameSymbolStr = this->name.getStr();
+      this->nameSymbol = Symbol(this->nameSymbolStr.getBuf());
+    }
+    return this->nameSymbol;
   }
+
+  public: void setTarget(TioSharedPtr const &t);
   private: void setTarget(TiObject *t)
   {
     this->setTarget(getSharedPtr(t));
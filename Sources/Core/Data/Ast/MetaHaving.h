@@ -104,6 +104,17 @@ class MetaHaving : public TiInterface
   public: virtual void removeExtra(Char const *name) = 0;
   public: virtual TioSharedPtr const& getExtra(Char const *name) const = 0;
 
+  /**
+   * @brief Set an extra by its slot.
+   *
+   * Slot based extras are kept in an array instead of the named extras map,
+   * which makes them suitable for data that is accessed frequently, like
+   * generated code. Slots are obtained from getExtraSlot.
+   */
+  public: virtual void setExtra(Word slot, TioSharedPtr const &obj) = 0;
+  public: virtual void removeExtra(Word slot) = 0;
+  public: virtual TioSharedPtr const& getExtra(Word slot) const = 0;
+
 }; // class
 
 
@@ -114,6 +125,7 @@ class MetaHaving : public TiInterface
   private: Core::Basic::TiWord prodId = UNKNOWN_ID; \
   private: Core::Basic::SharedPtr<Core::Data::SourceLocation> sourceLocation; \
   private: Core::Basic::SharedMap<Core::Basic::TiObject> extras; \
+  private: std::vector<Core::Basic::TioSharedPtr> slotExtras; \
   public: using MetaHaving::setProdId; \
   public: virtual void setProdId(Word id) \
   { \
@@ -150,6 +162,20 @@ class MetaHaving : public TiInterface
     auto index = this->extras.findIndex(name); \
     if (index == -1) return TioSharedPtr::null; \
     else return this->extras.get(index); \
+  } \
+  public: virtual void setExtra(Word slot, TioSharedPtr const &obj) \
+  { \
+    if (slot >= this->slotExtras.size()) this->slotExtras.resize(slot + 1); \
+    this->slotExtras[slot] = obj; \
+  } \
+  public: virtual void removeExtra(Word slot) \
+  { \
+    if (slot < this->slotExtras.size()) this->slotExtras[slot].release(); \
+  } \
+  public: virtual TioSharedPtr const& getExtra(Word slot) const \
+  { \
+    if (slot >= this->slotExtras.size()) return TioSharedPtr::null; \
+    else return this->slotExtras[slot]; \
   }
 
 } // namespace
@@ -21,22 +21,76 @@ namespace Core::Data::Ast
 void Scope::onAdded(Int index)
 {
   this->bridgesIndex.onAdded(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  if (this->definitionsIndexValid) {
+    if (index == this->getCount() - 1) {
+      auto def = ti_cast<Definition>(this->getElement(index));
+      if (def != 0) this->definitionsIndex[def->getNameSymbol()].push_back(index);
+    } else {
+      this->definitionsIndexValid = false;
+    }
+  }
   List::onAdded(index);
 }
 
 void Scope::onUpdated(Int index)
 {
   this->bridgesIndex.onUpdated(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  this->definitionsIndexValid = false;
   List::onUpdated(index);
 }
 
+void Scope::onWillRemove(Int index)
+{
+  if (this->definitionsIndexValid && index == this->getCount() - 1) {
+    auto def = ti_cast<Definition>(this->getElement(index));
+    if (def != 0) {
+      auto iter = this->definitionsIndex.find(def->getNameSymbol());
+      if (iter != this->definitionsIndex.end() && !iter->second.empty() && iter->second.back() == index) {
+        iter->second.pop_back();
+        if (iter->second.empty()) this->definitionsIndex.erase(iter);
+        this->removalIndexed = true;
+      }
+    } else {
+      this->removalIndexed = true;
+    }
+  }
+  List::onWillRemove(index);
+}
+
 void Scope::onRemoved(Int index)
 {
   this->bridgesIndex.onRemoved(index);
+  if (!this->removalIndexed) this->definitionsIndexValid = false;
+  this->removalIndexed = false;
   List::onRemoved(index);
 }
 
 
+//==============================================================================
+// Definition Lookup Functions
+
+Int Scope::findDefinitionIndex(Symbol const &name, Int occurrence) const
+{
+  // Definition names are always interned, so a null symbol can't match any of them.
+  if (name.isNull()) return -1;
+  if (!this->definitionsIndexValid) this->rebuildDefinitionsIndex();
+  auto iter = this->definitionsIndex.find(name);
+  if (iter == this->definitionsIndex.end() || occurrence >= iter->second.size()) return -1;
+  return iter->second[occurrence];
+}
+
+
+void Scope::rebuildDefinitionsIndex() const
+{
+  this->definitionsIndex.clear();
+  for (Int i = 0; i < this->getCount(); ++i) {
+    auto def = ti_cast<Definition>(this->getElement(i));
+    if (def != 0) this->definitionsIndex[def->getNameSymbol()].push_back(i);
+  }
+  this->definitionsIndexValid = true;
+}
+
+
 //==============================================================================
 // Bridge Retrieval Functions
 
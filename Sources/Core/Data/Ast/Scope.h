@@ -30,6 +30,32 @@ class Scope : public List
 
   private: SubsetIndex bridgesIndex;
 
+  /// The positions of the definitions in this scope, in order, keyed by name symbol.
+  private: mutable std::unordered_map<Symbol, std::vector<Int>> definitionsIndex;
+
+  /**
+   * @brief Whether definitionsIndex is up to date.
+   *
+   * Appending or removing the last element updates the index directly. Other
+   * modifications invalidate it and it gets rebuilt on the next lookup.
+   */
+  private: mutable Bool definitionsIndexValid = true;
+
+  /// Whether onWillRemove already removed the element being removed from definitionsIndex.
+  private: Bool removalIndexed = false;
+
+
+  //============================================================================
+  // Signals
+
+  /**
+   * @brief Emitted when a definition in this scope is renamed or retargeted.
+   *
+   * These modifications don't change the scope's elements, so they aren't
+   * reported through changeNotifier.
+   */
+  public: Signal<void, Scope*, Definition*> definitionChangeNotifier;
+
 
   //============================================================================
   // Implementations
@@ -57,10 +83,56 @@ class Scope : public List
 
   protected: virtual void onUpdated(Int index);
 
+  protected: virtual void onWillRemove(Int index);
+
   protected: virtual void onRemoved(Int index);
 
   /// @}
 
+  /// @name Definition Lookup Functions
+  /// @{
+
+  /**
+   * @brief Get the position of a definition with the given name.
+   *
+   * Definitions with the same name are ordered by their position within the
+   * scope. Callers looping through those definitions should look them up by
+   * occurrence in each iteration since the positions change if the scope is
+   * modified.
+   *
+   * @param name The name of the definition.
+   * @param occurrence The index of the definition among those with the same
+   *                   name.
+   * @return The index of the definition's element, or -1 if not found.
+   */
+  public: Int findDefinitionIndex(Symbol const &name, Int occurrence = 0) const;
+
+  /// @sa findDefinitionIndex(Symbol const &name, Int occurrence)
+  public: Int findDefinitionIndex(Str const &name, Int occurrence = 0) const
+  {
+    return this->findDefinitionIndex(Symbol::find(name.getBuf()), occurrence);
+  }
+
+  /**
+   * @brief Notify the scope that one of its definitions was modified.
+   *
+   * Called by definitions owned by this scope after they are renamed or get a
+   * new target.
+   *
+   * @param def The modified definition.
+   * @param renamed Whether the definition was renamed, which outdates the
+   *                definitions index.
+   */
+  public: void onDefinitionChanged(Definition *def, Bool renamed)
+  {
+    if (renamed) this->definitionsIndexValid = false;
+    this->definitionChangeNotifier.emit(this, def);
+  }
+
+  private: void rebuildDefinitionsIndex() const;
+
+  /// @}
+
   /// @name Bridge Retrieval Functions
   /// @{
 
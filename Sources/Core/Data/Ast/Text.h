@@ -39,6 +39,18 @@ class Text : public Node, public Binding, public MetaHaving, public Printable
    */
   private: TiStr value;
 
+  /// The symbol of value, looked up on demand by getValueSymbol.
+  private: mutable Symbol valueSymbol;
+
+  /**
+   * @brief A copy of value at the time valueSymbol was looked up.
+   *
+   * Alusus code can write to value directly, so the copy is used to detect
+   * that value has changed. The copy shares the string's buffer, so the
+   * buffer can't be reused for a different value while the copy is alive.
+   */
+  private: mutable Str valueSymbolStr;
+
 
   //============================================================================
   // Implementations
@@ -82,6 +94,22 @@ class Text : public Node, public Binding, public MetaHaving, public Printable
     return this->value;
   }
 
+  /**
+   * @brief Get the symbol of the value without interning it.
+   *
+   * Returns a null symbol if the value isn't interned, which means it doesn't
+   * match the name of any definition. Null results aren't cached since a
+   * definition with that name can be added later.
+   */
+  public: Symbol const& getValueSymbol() const
+  {
+    if (this->valueSymbol.isNull() || this->value.getStr().getBuf() != this->valueSymbolStr.getBuf()) {
+      this->valueSymbolStr = this->value.getStr();
+      this->valueSymbol = Symbol::find(this->valueSymbolStr.getBuf());
+    }
+    return this->valueSymbol;
+  }
+
 
   //============================================================================
   // Printable Implementation
@@ -43,6 +43,34 @@ void addSourceLocation(TiObject *obj, SourceLocation *sl)
 }
 
 
+Word getExtraSlot(Char const *name)
+{
+  struct ExtraSlots
+  {
+    std::unordered_map<Str, Word, std::hash<Str>> slots;
+    std::mutex mutex;
+  };
+
+  // Slots can be requested from multiple threads, so the pointer is a function local static, which is initialized
+  // only once even if multiple threads reach it at the same time.
+  static ExtraSlots *extraSlots = []() {
+    auto slots = reinterpret_cast<ExtraSlots*>(GLOBAL_STORAGE->getObject(S("Core::Data::Ast::ExtraSlots")));
+    if (slots == 0) {
+      slots = new ExtraSlots;
+      GLOBAL_STORAGE->setObject(S("Core::Data::Ast::ExtraSlots"), reinterpret_cast<void*>(slots));
+    }
+    return slots;
+  }();
+
+  std::lock_guard<std::mutex> lock(extraSlots->mutex);
+  auto iter = extraSlots->slots.find(Str(name));
+  if (iter != extraSlots->slots.end()) return iter->second;
+  Word slot = extraSlots->slots.size();
+  extraSlots->slots[Str(name)] = slot;
+  return slot;
+}
+
+
 Bool mergeDefinition(
   Definition *def, DynamicContaining<TiObject> *target, Int &index, Data::Seeker *seeker, Notices::Store *noticeStore
 ) {
@@ -83,6 +83,15 @@ SharedPtr<SourceLocation> const& findSourceLocation(TiObject const *obj);
 
 void addSourceLocation(TiObject *obj, SourceLocation *sl);
 
+/**
+ * @brief Get the slot of the MetaHaving extra with the given name.
+ *
+ * Slots are allocated sequentially the first time each name is requested and
+ * are shared among all libraries, so a group of names registered together gets
+ * a contiguous range of slots.
+ */
+Word getExtraSlot(Char const *name);
+
 Bool mergeDefinition(
   Definition *def, DynamicContaining<TiObject> *target, Int &index, Data::Seeker *seeker, Notices::Store *noticeStore
 );
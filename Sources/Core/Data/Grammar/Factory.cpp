@@ -191,6 +191,9 @@ Word Factory::addConstToken(Char const *text)
 
 SharedPtr<SymbolDefinition> Factory::createConstTokenDef(Char const *text)
 {
+  // Const tokens are keywords to the parser, whose decision caches are keyed by the symbols of keyword tokens.
+  // Tokens only look their symbols up, so the text needs to be interned here.
+  SymbolTable::getSingleton()->intern(text);
   return SymbolDefinition::create({
     {S("flags"), TiInt::create(SymbolFlags::ROOT_TOKEN)}
   }, {
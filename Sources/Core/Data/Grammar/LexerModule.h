@@ -40,6 +40,32 @@ class LexerModule : public Module, public CacheHaving
 
   private: CharBasedDecisionCache charBasedDecisionCache;
 
+  /**
+   * @brief The state machine compiled by the lexer from this module.
+   *
+   * The lexer compiles the module's token definitions once and caches the
+   * result here to be reused by all lexers using this module until the caches
+   * are cleared.
+   */
+  private: TioSharedPtr compiledDfa;
+
+  /**
+   * @brief A counter incremented whenever the token definitions change.
+   *
+   * This is incremented when a definition is added, replaced, or removed, or
+   * when one of the definitions is modified. The lexer compares it against
+   * the version the cached DFA was compiled from to know when to recompile.
+   */
+  private: Word definitionsVersion = 0;
+
+
+  //============================================================================
+  // Signals & Slots
+
+  private: Slot<void, SymbolDefinition*, SymbolDefinition::ChangeOp, Word> definitionChangeSlot = {
+    this, &LexerModule::onDefinitionChanged
+  };
+
 
   //============================================================================
   // Constructor & Destructor
@@ -58,6 +84,7 @@ class LexerModule : public Module, public CacheHaving
 
   public: virtual ~LexerModule()
   {
+    this->definitionChangeSlot.disconnect();
   }
 
   public: static SharedPtr<LexerModule> create(
@@ -75,6 +102,66 @@ class LexerModule : public Module, public CacheHaving
     return &this->charBasedDecisionCache;
   }
 
+  public: void setCompiledDfa(TioSharedPtr const &dfa)
+  {
+    this->compiledDfa = dfa;
+  }
+
+  public: TioSharedPtr const& getCompiledDfa() const
+  {
+    return this->compiledDfa;
+  }
+
+  public: Word getDefinitionsVersion() const
+  {
+    return this->definitionsVersion;
+  }
+
+  private: void onDefinitionChanged(SymbolDefinition *def, SymbolDefinition::ChangeOp op, Word element)
+  {
+    ++this->definitionsVersion;
+  }
+
+
+  //============================================================================
+  // Module Overrides
+
+  protected: virtual void finalizeSet(
+    Char const *key, Int index, SharedPtr<TiObject> const &obj, Bool inherited, Bool newEntry
+  ) {
+    Module::finalizeSet(key, index, obj, inherited, newEntry);
+    if (obj != 0 && obj->isDerivedFrom<SymbolDefinition>()) {
+      obj.s_cast_get<SymbolDefinition>()->changeNotifier.connect(this->definitionChangeSlot);
+    }
+  }
+
+  protected: virtual void prepareForUnset(
+    Char const *key, Int index, SharedPtr<TiObject> const &obj, Bool inherited
+  ) {
+    if (obj != 0 && obj->isDerivedFrom<SymbolDefinition>()) {
+      obj.s_cast_get<SymbolDefinition>()->changeNotifier.disconnect(this->definitionChangeSlot);
+    }
+    Module::prepareForUnset(key, index, obj, inherited);
+  }
+
+  protected: virtual void onAdded(Int index)
+  {
+    ++this->definitionsVersion;
+    Module::onAdded(index);
+  }
+
+  protected: virtual void onUpdated(Int index)
+  {
+    ++this->definitionsVersion;
+    Module::onUpdated(index);
+  }
+
+  protected: virtual void onRemoved(Int index)
+  {
+    ++this->definitionsVersion;
+    Module::onRemoved(index);
+  }
+
 
   //============================================================================
   // CacheHaving Implementation
@@ -83,6 +170,7 @@ class LexerModule : public Module, public CacheHaving
   public: virtual void clearCache()
   {
     this->charBasedDecisionCache.clear();
+    this->compiledDfa.reset();
   }
 
 }; // class
@@ -45,7 +45,7 @@ class MultiplyTerm : public Term, public CacheHaving, public MapContaining<TiObj
   //============================================================================
   // Types
 
-  public: typedef std::unordered_map<Str, Int, std::hash<Str>> TextBasedDecisionCache;
+  public: typedef std::unordered_map<Symbol, Int> TextBasedDecisionCache;
   public: typedef std::unordered_map<Word, Int> IdBasedDecisionCache;
 
 
@@ -34,6 +34,12 @@ class TokenTerm : public Term
 
   private: TioSharedPtr tokenText;
 
+  /// The interned symbol of tokenText if it's a string.
+  private: Symbol tokenSymbol;
+
+  /// A copy of the string value of tokenText used to detect changes to the string after the symbol is interned.
+  private: Str tokenSymbolStr;
+
 
   //============================================================================
   // Implementations
@@ -85,6 +91,15 @@ class TokenTerm : public Term
       throw EXCEPTION(InvalidArgumentException, S("text"), S("Must be of type TiStr or Reference."));
     }
     UPDATE_OWNED_SHAREDPTR(this->tokenText, text);
+    if (text != 0 && text->isA<TiStr>()) {
+      // The copy shares the string's buffer, so the buffer can't be reused for a different value while the copy is
+      // alive, and comparing buffer pointers is enough to tell whether the string is still unchanged.
+      this->tokenSymbolStr = static_cast<TiStr*>(text.get())->getStr();
+      this->tokenSymbol = Symbol(this->tokenSymbolStr.getBuf());
+    } else {
+      this->tokenSymbolStr = Str();
+      this->tokenSymbol = Symbol();
+    }
   }
 
   private: void setTokenText(TiObject *text)
@@ -97,6 +112,18 @@ class TokenTerm : public Term
     return this->tokenText;
   }
 
+  /**
+   * @brief Get the interned symbol of the token text.
+   * Returns a null symbol if the token text isn't a string or if the string
+   * was modified after it was set on this term.
+   */
+  public: Symbol getTokenSymbol() const
+  {
+    auto str = this->tokenText.ti_cast_get<TiStr>();
+    if (str == 0 || str->getStr().getBuf() != this->tokenSymbolStr.getBuf()) return Symbol();
+    return this->tokenSymbol;
+  }
+
 }; // class
 
 } // namespace
@@ -181,7 +181,6 @@ template <class T> SharedPtr<T> cloneInherited(T *obj)
 #include "List.h"
 #include "Map.h"
 #include "Module.h"
-#include "LexerModule.h"
 
 // Character Groups
 #include "CharGroupUnit.h"
@@ -205,6 +204,7 @@ template <class T> SharedPtr<T> cloneInherited(T *obj)
 // Other Grammar Definitions
 #include "BuildHandler.h"
 #include "SymbolDefinition.h"
+#include "LexerModule.h"
 // TODO: #include "SymbolGroup.h"
 #include "ParsingDimension.h"
 
@@ -20,13 +20,15 @@ namespace Core { namespace Data
 
 Word IdGenerator::getId(Char const *desc)
 {
-  Int id = this->index.findPos(Str(true, desc));
-  if (id == -1) {
+  Symbol symbol(desc);
+  auto iter = this->index.find(symbol);
+  if (iter == this->index.end()) {
+    Word id = this->ids.getLength();
     this->ids.add(desc);
-    this->index.add(-1);
-    return this->ids.getLength()-1;
+    this->index[symbol] = id;
+    return id;
   } else {
-    return static_cast<Word>(id);
+    return iter->second;
   }
 }
 
@@ -35,14 +35,14 @@ class IdGenerator
   // Member Variables
 
   private: Srl::Array<Str> ids;
-  private: Srl::ArrayIndex<Str> index;
+  private: std::unordered_map<Symbol, Word> index;
 
 
   //============================================================================
   // Constructor
 
   /// Prevent the singleton class from being inistantiated.
-  private: IdGenerator() : index(&ids)
+  private: IdGenerator()
   {
     this->getId(S("UNKNOWN"));
   }
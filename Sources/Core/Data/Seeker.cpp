@@ -11,6 +11,7 @@
 //==============================================================================
 
 #include "core.h"
+#include <algorithm>
 
 namespace Core::Data
 {
@@ -147,21 +148,142 @@ Bool Seeker::tryRemove(TiObject const *ref, TiObject *target, Word flags)
 
 Bool Seeker::tryGet(TiObject const *ref, TiObject *target, TiObject *&retVal, Word flags)
 {
-  Bool ret = false;
-  this->extForeach(ref, target, [&ret, &retVal](TiInt action, TiObject *o)->Verb {
-    retVal = o;
-    ret = true;
-    return Verb::STOP;
-  }, flags);
+  return this->lookup(ref, target, 0, retVal, flags);
+}
+
+
+Bool Seeker::lookup(TiObject const *ref, TiObject *target, TypeInfo const *ti, TiObject *&retVal, Word flags)
+{
+  if (!this->cacheEnabled || !target->isDerivedFrom<Node>() || target->getWkThis() == nullptr) {
+    return this->performLookup(ref, target, ti, retVal, flags);
+  }
+  CacheKey key;
+  if (!Seeker::buildCacheRef(ref, key.ref)) return this->performLookup(ref, target, ti, retVal, flags);
+  key.target = target;
+  key.typeInfo = ti;
+  key.flags = flags;
+
+  auto iter = this->cache.find(key);
+  if (iter != this->cache.end()) {
+    if (Seeker::isCacheEntryValid(iter->second, target)) {
+      ++this->cacheHitCount;
+      if (!this->lookupDependencies.empty()) {
+        // The enclosing lookup depends on whatever this cached lookup depends on.
+        auto &deps = this->lookupDependencies.back();
+        deps.insert(deps.end(), iter->second.dependencies.begin(), iter->second.dependencies.end());
+      }
+      if (iter->second.result == 0) return false;
+      retVal = iter->second.result;
+      return true;
+    }
+    this->eraseCacheEntry(iter);
+  }
+  ++this->cacheMissCount;
+
+  TiObject *result = 0;
+  Word generation = this->cacheGeneration;
+  this->lookupDependencies.emplace_back();
+  Bool ret;
+  try {
+    ret = this->performLookup(ref, target, ti, result, flags);
+  } catch (...) {
+    this->lookupDependencies.pop_back();
+    throw;
+  }
+  std::vector<void*> dependencies = std::move(this->lookupDependencies.back());
+  this->lookupDependencies.pop_back();
+  if (!this->lookupDependencies.empty()) {
+    auto &deps = this->lookupDependencies.back();
+    deps.insert(deps.end(), dependencies.begin(), dependencies.end());
+  }
+
+  // Lookups that didn't search any container are cheap and have nothing that would drop their entries, so they
+  // aren't cached.
+  if (generation == this->cacheGeneration && !dependencies.empty()) {
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+    CacheEntry entry;
+    for (auto node = static_cast<Node*>(target)->getOwner(); node != 0; node = node->getOwner()) {
+      entry.owners.push_back(node);
+    }
+    entry.result = ret ? result : 0;
+    for (auto dependency : dependencies) this->getCacheWatch(dependency)->dependents.insert(key);
+    entry.dependencies = std::move(dependencies);
+    this->cache[key] = std::move(entry);
+  }
+  if (ret) retVal = result;
   return ret;
 }
 
 
-Bool Seeker::find(TiObject const *ref, TiObject *target, TypeInfo const *ti, TiObject *&retVal, Word flags)
+void Seeker::watchForChanges(Ast::Scope *scope)
 {
+  if (this->lookupDependencies.empty()) return;
+  auto list = static_cast<SharedListBase<TiObject, Node>*>(scope);
+  scope->definitionChangeNotifier.connect(this->getCacheWatch(list)->definitionChangeSlot);
+  this->watchForChanges(list);
+}
+
+
+Seeker::CacheWatch* Seeker::getCacheWatch(void *container)
+{
+  auto &watch = this->cacheWatches[container];
+  if (watch == nullptr) watch = std::make_unique<CacheWatch>(this, container);
+  return watch.get();
+}
+
+
+void Seeker::invalidateCache(void *container)
+{
+  auto iter = this->cacheWatches.find(container);
+  if (iter != this->cacheWatches.end()) {
+    auto keys = std::move(iter->second->dependents);
+    iter->second->dependents.clear();
+    for (auto const &key : keys) {
+      auto entryIter = this->cache.find(key);
+      if (entryIter != this->cache.end()) this->eraseCacheEntry(entryIter);
+    }
+  }
+  // Results of lookups still in progress may already depend on the old content.
+  this->markUncacheable();
+}
+
+
+void Seeker::onContainerDestroyed(void *container)
+{
+  this->invalidateCache(container);
+
+  // Free the watches of containers that are done being destroyed. This watch is still connected to the signal that
+  // is firing, so it's retired until a later call.
+  for (Int i = this->retiredCacheWatches.size() - 1; i >= 0; --i) {
+    if (!this->retiredCacheWatches[i]->isConnected()) {
+      this->retiredCacheWatches.erase(this->retiredCacheWatches.begin() + i);
+    }
+  }
+  auto iter = this->cacheWatches.find(container);
+  if (iter != this->cacheWatches.end()) {
+    this->retiredCacheWatches.push_back(std::move(iter->second));
+    this->cacheWatches.erase(iter);
+  }
+}
+
+
+void Seeker::eraseCacheEntry(std::unordered_map<CacheKey, CacheEntry, CacheKeyHasher>::iterator iter)
+{
+  for (auto dependency : iter->second.dependencies) {
+    auto watchIter = this->cacheWatches.find(dependency);
+    if (watchIter != this->cacheWatches.end()) watchIter->second->dependents.erase(iter->first);
+  }
+  this->cache.erase(iter);
+}
+
+
+Bool Seeker::performLookup(
+  TiObject const *ref, TiObject *target, TypeInfo const *ti, TiObject *&retVal, Word flags
+) {
   Bool ret = false;
   this->extForeach(ref, target, [ti, &ret, &retVal](TiInt action, TiObject *o)->Verb {
-    if (o->isDerivedFrom(ti)) {
+    if (ti == 0 || o->isDerivedFrom(ti)) {
       retVal = o;
       ret = true;
       return Verb::STOP;
@@ -173,6 +295,53 @@ Bool Seeker::find(TiObject const *ref, TiObject *target, TypeInfo const *ti, TiO
 }
 
 
+//==============================================================================
+// Cache Functions
+
+void Seeker::clearCache()
+{
+  this->cache.clear();
+  ++this->cacheGeneration;
+  // Freeing the watches disconnects their slots.
+  this->cacheWatches.clear();
+  this->retiredCacheWatches.clear();
+}
+
+
+Bool Seeker::buildCacheRef(TiObject const *ref, std::string &text)
+{
+  if (ref->isA<Ast::Identifier>()) {
+    text += static_cast<Ast::Identifier const*>(ref)->getValue().get();
+    return true;
+  } else if (ref->isA<Ast::LinkOperator>()) {
+    auto link = static_cast<Ast::LinkOperator const*>(ref);
+    if (link->getType() != S(".")) return false;
+    auto first = link->getFirst().get();
+    auto second = link->getSecond().ti_cast_get<Ast::Identifier>();
+    if (first == 0 || second == 0 || !second->isA<Ast::Identifier>()) return false;
+    if (!Seeker::buildCacheRef(first, text)) return false;
+    text += '.';
+    text += second->getValue().get();
+    return true;
+  } else {
+    return false;
+  }
+}
+
+
+Bool Seeker::isCacheEntryValid(CacheEntry const &entry, TiObject *target)
+{
+  // The result depends on the owners of the target, which might have changed without notifying the containers
+  // watched during the lookup.
+  auto node = static_cast<Node*>(target)->getOwner();
+  for (auto owner : entry.owners) {
+    if (node != owner) return false;
+    node = node->getOwner();
+  }
+  return node == 0;
+}
+
+
 //==============================================================================
 // Main Seek Functions
 
@@ -304,16 +473,16 @@ Seeker::Verb Seeker::_setByIdentifier_scope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, SetCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(Action::TARGET_MATCH, obj);
-      if (isPerform(verb)) {
-        def->setTarget(getSharedPtr(obj));
-      }
-      if (!Seeker::isMove(verb)) break;
+  for (Int j = 0;; ++j) {
+    Int i = scope->findDefinitionIndex(identifier->getValueSymbol(), j);
+    if (i == -1) break;
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(Action::TARGET_MATCH, obj);
+    if (isPerform(verb)) {
+      def->setTarget(getSharedPtr(obj));
     }
+    if (!Seeker::isMove(verb)) break;
   }
   if (Seeker::isMove(verb)) {
     TiObject *obj = 0;
@@ -389,17 +558,17 @@ Seeker::Verb Seeker::_removeByIdentifier_scope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, RemoveCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(Action::TARGET_MATCH, obj);
-      if (isPerform(verb)) {
-        scope->remove(i);
-        --i;
-      }
-      if (!Seeker::isMove(verb)) return verb;
+  for (Int j = 0;; ++j) {
+    Int i = scope->findDefinitionIndex(identifier->getValueSymbol(), j);
+    if (i == -1) break;
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(Action::TARGET_MATCH, obj);
+    if (isPerform(verb)) {
+      scope->remove(i);
+      --j;
     }
+    if (!Seeker::isMove(verb)) return verb;
   }
   return verb;
 }
@@ -482,32 +651,31 @@ Seeker::Verb Seeker::_foreachByIdentifier_level(
 Seeker::Verb Seeker::_foreachByIdentifier_scope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, ForeachCallback const &cb, Word flags
 ) {
+  PREPARE_SELF(seeker, Seeker);
+  seeker->watchForChanges(scope);
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      if (obj->isDerivedFrom<Ast::Alias>()) {
-        verb = cb(Action::ALIAS_TRACE_START, obj);
-        if (verb == Verb::SKIP) return Verb::MOVE;
-        else if (!Seeker::isMove(verb)) return verb;
-        PREPARE_SELF(seeker, Seeker);
-        auto alias = static_cast<Ast::Alias*>(obj);
-        verb = seeker->foreach(
-          alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
-        );
-        if (!Seeker::isMove(verb)) return verb;
-        verb = cb(Action::ALIAS_TRACE_END, obj);
-        if (verb != Verb::MOVE) return verb;
-      } else {
-        verb = cb(Action::TARGET_MATCH, obj);
-        if (!Seeker::isMove(verb)) return verb;
-      }
+  for (Int j = 0;; ++j) {
+    Int i = scope->findDefinitionIndex(identifier->getValueSymbol(), j);
+    if (i == -1) break;
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    if (obj->isDerivedFrom<Ast::Alias>()) {
+      verb = cb(Action::ALIAS_TRACE_START, obj);
+      if (verb == Verb::SKIP) return Verb::MOVE;
+      else if (!Seeker::isMove(verb)) return verb;
+      auto alias = static_cast<Ast::Alias*>(obj);
+      verb = seeker->foreach(
+        alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
+      );
+      if (!Seeker::isMove(verb)) return verb;
+      verb = cb(Action::ALIAS_TRACE_END, obj);
+      if (verb != Verb::MOVE) return verb;
+    } else {
+      verb = cb(Action::TARGET_MATCH, obj);
+      if (!Seeker::isMove(verb)) return verb;
     }
   }
 
-  PREPARE_SELF(seeker, Seeker);
-
   if (scope->getBridgeCount() > 0) {
     verb = cb(Action::USE_SCOPES_START, scope);
     if (verb == Verb::SKIP) return verb;
@@ -585,16 +753,16 @@ Seeker::Verb Seeker::_setByLinkOperator_scopeDotIdentifier(
   TiObject *self, Ast::Identifier const *identifier, Ast::Scope *scope, SetCallback const &cb, Word flags
 ) {
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(Action::TARGET_MATCH, obj);
-      if (isPerform(verb)) {
-        def->setTarget(getSharedPtr(obj));
-      }
-      if (!Seeker::isMove(verb)) break;
+  for (Int j = 0;; ++j) {
+    Int i = scope->findDefinitionIndex(identifier->getValueSymbol(), j);
+    if (i == -1) break;
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(Action::TARGET_MATCH, obj);
+    if (isPerform(verb)) {
+      def->setTarget(getSharedPtr(obj));
     }
+    if (!Seeker::isMove(verb)) break;
   }
   if (Seeker::isMove(verb)) {
     TiObject *obj = 0;
@@ -675,17 +843,17 @@ Seeker::Verb Seeker::_removeByLinkOperator_scopeDotIdentifier(
   TiObject *self, Data::Ast::Identifier const *identifier, Data::Ast::Scope *scope, RemoveCallback const &cb, Word flags
 ) {
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(Action::TARGET_MATCH, obj);
-      if (isPerform(verb)) {
-        scope->remove(i);
-        --i;
-      }
-      if (!Seeker::isMove(verb)) break;
+  for (Int j = 0;; ++j) {
+    Int i = scope->findDefinitionIndex(identifier->getValueSymbol(), j);
+    if (i == -1) break;
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(Action::TARGET_MATCH, obj);
+    if (isPerform(verb)) {
+      scope->remove(i);
+      --j;
     }
+    if (!Seeker::isMove(verb)) break;
   }
   return verb;
 }
@@ -758,27 +926,28 @@ Seeker::Verb Seeker::_foreachByLinkOperator_routing(
 Seeker::Verb Seeker::_foreachByLinkOperator_scopeDotIdentifier(
   TiObject *self, Data::Ast::Identifier *identifier, Data::Ast::Scope *scope, ForeachCallback const &cb, Word flags
 ) {
+  PREPARE_SELF(seeker, Seeker);
+  seeker->watchForChanges(scope);
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      if (obj->isDerivedFrom<Ast::Alias>()) {
-        verb = cb(Action::ALIAS_TRACE_START, obj);
-        if (verb == Verb::SKIP) return Verb::MOVE;
-        else if (!Seeker::isMove(verb)) return verb;
-        PREPARE_SELF(seeker, Seeker);
-        auto alias = static_cast<Ast::Alias*>(obj);
-        verb = seeker->foreach(
-          alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
-        );
-        if (!Seeker::isMove(verb)) break;
-        verb = cb(Action::ALIAS_TRACE_END, obj);
-        if (verb != Verb::MOVE) return verb;
-      } else {
-        verb = cb(Action::TARGET_MATCH, obj);
-        if (!Seeker::isMove(verb)) break;
-      }
+  for (Int j = 0;; ++j) {
+    Int i = scope->findDefinitionIndex(identifier->getValueSymbol(), j);
+    if (i == -1) break;
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    if (obj->isDerivedFrom<Ast::Alias>()) {
+      verb = cb(Action::ALIAS_TRACE_START, obj);
+      if (verb == Verb::SKIP) return Verb::MOVE;
+      else if (!Seeker::isMove(verb)) return verb;
+      auto alias = static_cast<Ast::Alias*>(obj);
+      verb = seeker->foreach(
+        alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
+      );
+      if (!Seeker::isMove(verb)) break;
+      verb = cb(Action::ALIAS_TRACE_END, obj);
+      if (verb != Verb::MOVE) return verb;
+    } else {
+      verb = cb(Action::TARGET_MATCH, obj);
+      if (!Seeker::isMove(verb)) break;
     }
   }
   return verb;
@@ -789,6 +958,10 @@ Seeker::Verb Seeker::_foreachByLinkOperator_mapDotIdentifier(
   TiObject *self, Data::Ast::Identifier const *identifier, MapContaining<TiObject> *map, ForeachCallback const &cb,
   Word flags
 ) {
+  PREPARE_SELF(seeker, Seeker);
+  auto sharedMap = ti_cast<SharedMapBase<TiObject, Node>>(map->getTiObject());
+  if (sharedMap != 0) seeker->watchForChanges(sharedMap);
+  else seeker->markUncacheable();
   auto index = map->findElementIndex(identifier->getValue().get());
   if (index == -1) return Verb::MOVE;
   auto obj = map->getElement(index);
@@ -796,7 +969,6 @@ Seeker::Verb Seeker::_foreachByLinkOperator_mapDotIdentifier(
     auto verb = cb(Action::ALIAS_TRACE_START, obj);
     if (verb == Verb::SKIP) return Verb::MOVE;
     else if (!Seeker::isMove(verb)) return verb;
-    PREPARE_SELF(seeker, Seeker);
     auto alias = static_cast<Ast::Alias*>(obj);
     verb = seeker->foreach(
       alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
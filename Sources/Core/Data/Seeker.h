@@ -58,6 +58,141 @@ class Seeker : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: typedef std::function<Verb(TiInt action, TiObject *obj)> RemoveCallback;
   public: typedef std::function<Verb(TiInt action, TiObject *obj)> ForeachCallback;
 
+  /// The key of an entry in the lookup cache.
+  private: struct CacheKey
+  {
+    /// A textual form of the reference, like `Srl.Console.print`.
+    std::string ref;
+    TiObject *target;
+    /// The type filter given to find, or null for tryGet.
+    TypeInfo const *typeInfo;
+    Word flags;
+
+    Bool operator==(CacheKey const &key) const
+    {
+      return this->target == key.target && this->typeInfo == key.typeInfo && this->flags == key.flags &&
+        this->ref == key.ref;
+    }
+  };
+
+  private: struct CacheKeyHasher
+  {
+    std::size_t operator()(CacheKey const &key) const
+    {
+      std::size_t hash = std::hash<std::string>()(key.ref);
+      hash ^= std::hash<void*>()(key.target) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      hash ^= std::hash<void const*>()(key.typeInfo) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      hash ^= std::hash<Word>()(key.flags) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      return hash;
+    }
+  };
+
+  /**
+   * @brief A cached lookup result.
+   *
+   * The target isn't kept alive by the entry. The result of a lookup depends
+   * only on the containers it searched, which include the scopes enclosing
+   * the target, and the entry is dropped when any of them changes or gets
+   * destroyed. If the target's address gets reused by another node before
+   * that, the owners chain check rejects the entry unless the new node sits in
+   * the same place, in which case the lookup yields the same result.
+   */
+  private: struct CacheEntry
+  {
+    /// The owners chain of the target at the time of the lookup.
+    std::vector<Node*> owners;
+    /// The result of the lookup, or null if the lookup failed.
+    TiObject *result;
+    /// The containers searched by the lookup, without duplicates. A change in any of them drops the entry.
+    std::vector<void*> dependencies;
+  };
+
+  /**
+   * @brief The slots watching a single container, and the keys of the cache entries depending on it.
+   *
+   * Each watched container gets its own slots so that disconnecting a slot
+   * from a destroyed container doesn't need to search the signals of every
+   * other watched container.
+   */
+  private: struct CacheWatch
+  {
+    Slot<void, SharedListBase<TiObject, Node>*, ContentChangeOp, Int> listChangeSlot;
+    Slot<void, SharedListBase<TiObject, Node>*> listDestroySlot;
+    Slot<void, SharedMapBase<TiObject, Node>*, ContentChangeOp, Int> mapChangeSlot;
+    Slot<void, SharedMapBase<TiObject, Node>*> mapDestroySlot;
+    Slot<void, Ast::Scope*, Ast::Definition*> definitionChangeSlot;
+    std::unordered_set<CacheKey, CacheKeyHasher> dependents;
+
+    CacheWatch(Seeker *seeker, void *container) :
+      listChangeSlot([=](SharedListBase<TiObject, Node>*, ContentChangeOp, Int) {
+        seeker->invalidateCache(container);
+      }),
+      listDestroySlot([=](SharedListBase<TiObject, Node>*) { seeker->onContainerDestroyed(container); }),
+      mapChangeSlot([=](SharedMapBase<TiObject, Node>*, ContentChangeOp, Int) {
+        seeker->invalidateCache(container);
+      }),
+      mapDestroySlot([=](SharedMapBase<TiObject, Node>*) { seeker->onContainerDestroyed(container); }),
+      definitionChangeSlot([=](Ast::Scope*, Ast::Definition*) { seeker->invalidateCache(container); })
+    {
+    }
+
+    Bool isConnected() const
+    {
+      return this->listChangeSlot.isConnected() || this->listDestroySlot.isConnected() ||
+        this->mapChangeSlot.isConnected() || this->mapDestroySlot.isConnected() ||
+        this->definitionChangeSlot.isConnected();
+    }
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /**
+   * @brief Cached results of tryGet and find calls.
+   *
+   * Only lookups of identifiers and chains of identifiers linked by `.` are
+   * cached. All containers visited while performing a cached lookup are
+   * watched for changes, and the entries depending on a container are dropped
+   * when it changes, when one of its definitions is renamed or retargeted, or
+   * when it gets destroyed.
+   */
+  private: std::unordered_map<CacheKey, CacheEntry, CacheKeyHasher> cache;
+
+  /// The watch of each container searched by a cached lookup.
+  private: std::unordered_map<void*, std::unique_ptr<CacheWatch>> cacheWatches;
+
+  /**
+   * @brief Watches of destroyed containers that are still being destroyed.
+   *
+   * A watch can't be freed from within its own destroy slot, since the signal
+   * still refers to the slot until it's done firing. Watches are freed once
+   * all their slots are disconnected.
+   */
+  private: std::vector<std::unique_ptr<CacheWatch>> retiredCacheWatches;
+
+  /**
+   * @brief The containers searched by the cacheable lookups in progress.
+   *
+   * Has an entry for each nested lookup. When a nested lookup is done its
+   * dependencies are added to those of the enclosing lookup.
+   */
+  private: std::vector<std::vector<void*>> lookupDependencies;
+
+  private: Bool cacheEnabled = true;
+
+  /**
+   * @brief A counter incremented whenever the cache is invalidated.
+   *
+   * Results of lookups that were in progress while the cache was invalidated
+   * are not cached.
+   */
+  private: Word cacheGeneration = 0;
+
+  private: Word cacheHitCount = 0;
+
+  private: Word cacheMissCount = 0;
+
 
   //============================================================================
   // Implementations
@@ -134,13 +269,22 @@ class Seeker : public TiObject, public DynamicBinding, public DynamicInterfacing
     return retVal;
   }
 
-  public: Bool find(TiObject const *ref, TiObject *target, TypeInfo const *ti, TiObject *&retVal, Word flags);
+  public: Bool find(TiObject const *ref, TiObject *target, TypeInfo const *ti, TiObject *&retVal, Word flags)
+  {
+    return this->lookup(ref, target, ti, retVal, flags);
+  }
 
   public: template<class T> Bool find(TiObject const *ref, TiObject *target, TiObject *&retVal, Word flags)
   {
     return this->find(ref, target, T::getTypeInfo(), retVal, flags);
   }
 
+  private: Bool lookup(TiObject const *ref, TiObject *target, TypeInfo const *ti, TiObject *&retVal, Word flags);
+
+  private: Bool performLookup(
+    TiObject const *ref, TiObject *target, TypeInfo const *ti, TiObject *&retVal, Word flags
+  );
+
   public: static Bool isPerform(Verb verb)
   {
     return (verb & Verb::PERFORM) != 0;
@@ -153,6 +297,97 @@ class Seeker : public TiObject, public DynamicBinding, public DynamicInterfacing
 
   /// @}
 
+  /// @name Cache Functions
+  /// @{
+
+  public: void setCacheEnabled(Bool enabled)
+  {
+    this->cacheEnabled = enabled;
+    if (!enabled) this->clearCache();
+  }
+
+  public: Bool isCacheEnabled() const
+  {
+    return this->cacheEnabled;
+  }
+
+  /// Drop all cached lookup results and stop watching containers for changes.
+  public: void clearCache();
+
+  /// Get the number of cacheable lookups that were served from the cache.
+  public: Word getCacheHitCount() const
+  {
+    return this->cacheHitCount;
+  }
+
+  /// Get the number of cacheable lookups that had to be performed.
+  public: Word getCacheMissCount() const
+  {
+    return this->cacheMissCount;
+  }
+
+  public: void resetCacheCounters()
+  {
+    this->cacheHitCount = 0;
+    this->cacheMissCount = 0;
+  }
+
+  /**
+   * @brief Watch the given container for changes while a lookup is cached.
+   *
+   * Seek functions call this for every container they search, including
+   * containers searched by extensions, so that cached results depending on
+   * that container are dropped when it changes.
+   */
+  public: void watchForChanges(SharedListBase<TiObject, Node> *list)
+  {
+    if (this->lookupDependencies.empty()) return;
+    auto watch = this->getCacheWatch(list);
+    list->changeNotifier.connect(watch->listChangeSlot);
+    list->destroyNotifier.connect(watch->listDestroySlot);
+    this->lookupDependencies.back().push_back(list);
+  }
+
+  public: void watchForChanges(Ast::Scope *scope);
+
+  public: void watchForChanges(SharedMapBase<TiObject, Node> *map)
+  {
+    if (this->lookupDependencies.empty()) return;
+    auto watch = this->getCacheWatch(map);
+    map->changeNotifier.connect(watch->mapChangeSlot);
+    map->destroyNotifier.connect(watch->mapDestroySlot);
+    this->lookupDependencies.back().push_back(map);
+  }
+
+  /**
+   * @brief Prevent the results of lookups in progress from being cached.
+   *
+   * Used by seek functions that depend on data that can't be watched for
+   * changes.
+   */
+  public: void markUncacheable()
+  {
+    if (!this->lookupDependencies.empty()) ++this->cacheGeneration;
+  }
+
+  /// Get the watch of the given container, creating it if it doesn't exist yet.
+  private: CacheWatch* getCacheWatch(void *container);
+
+  /// Drop the cached results depending on the given container.
+  private: void invalidateCache(void *container);
+
+  /// Drop the cached results depending on the given container and stop watching it.
+  private: void onContainerDestroyed(void *container);
+
+  /// Drop a cache entry and remove its key from the watches of all the containers it depends on.
+  private: void eraseCacheEntry(std::unordered_map<CacheKey, CacheEntry, CacheKeyHasher>::iterator iter);
+
+  private: static Bool buildCacheRef(TiObject const *ref, std::string &text);
+
+  private: static Bool isCacheEntryValid(CacheEntry const &entry, TiObject *target);
+
+  /// @}
+
   /// @name Main Seek Functions
   /// @{
 
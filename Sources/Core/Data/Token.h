@@ -51,6 +51,18 @@ class Token : public Node
    */
   private: Str text;
 
+  /**
+   * @brief The interned symbol of the token text.
+   *
+   * This is looked up on demand and reset whenever the text changes. It's
+   * null if the text isn't interned, which is the case for texts that don't
+   * appear in the grammar.
+   */
+  private: mutable Symbol symbol;
+
+  /// Whether symbol was looked up for the current text.
+  private: mutable Bool symbolLookedUp = false;
+
   /// The location of the token in the source code.
   private: SourceLocationRecord sourceLocation;
 
@@ -102,6 +114,7 @@ class Token : public Node
   public: void setText(Char const *t)
   {
     this->text = t;
+    this->symbolLookedUp = false;
   }
 
   /**
@@ -112,6 +125,7 @@ class Token : public Node
   public: void setText(WChar const *t)
   {
     this->text.assign(t);
+    this->symbolLookedUp = false;
   }
 
   /**
@@ -123,6 +137,7 @@ class Token : public Node
   public: void setText(Char const *t, Int s)
   {
     this->text.assign(t, s);
+    this->symbolLookedUp = false;
   }
 
   /**
@@ -134,6 +149,7 @@ class Token : public Node
   public: void setText(WChar const *t, Int s)
   {
     this->text.assign(t, s);
+    this->symbolLookedUp = false;
   }
 
   /**
@@ -146,6 +162,23 @@ class Token : public Node
     return this->text;
   }
 
+  /**
+   * Get the interned symbol of the token text.
+   *
+   * Symbols can be compared and hashed without touching the text, which
+   * makes them suitable for keys of lookup tables that are queried for every
+   * token. The text isn't interned by this function, so a null symbol is
+   * returned if the text doesn't match any interned string.
+   */
+  public: Symbol const& getSymbol() const
+  {
+    if (!this->symbolLookedUp) {
+      this->symbol = Symbol::find(this->text.getBuf());
+      this->symbolLookedUp = true;
+    }
+    return this->symbol;
+  }
+
   /// Set the location of the token within the source code.
   public: void setSourceLocation(SourceLocationRecord const &loc)
   {
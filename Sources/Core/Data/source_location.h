@@ -73,7 +73,8 @@ class SourceLocationRecord : public SourceLocation
 
   public: Bool operator==(SourceLocationRecord const &sl) const
   {
-    return this->filename == sl.filename && this->line == sl.line && this->column == sl.column;
+    return this->line == sl.line && this->column == sl.column &&
+      (this->filename.getBuf() == sl.filename.getBuf() || this->filename == sl.filename);
   }
 
 }; // class
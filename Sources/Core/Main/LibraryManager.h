@@ -72,6 +72,16 @@ class LibraryManager : public TiObject
 
   public: LibraryGateway* getGateway(Char const *libId);
 
+  public: Word getLibraryCount() const
+  {
+    return this->entries.size();
+  }
+
+  public: LibraryGateway* getGatewayAt(Word index) const
+  {
+    return this->entries[index].gateway;
+  }
+
   public: PtrWord load(Char const *path, Str &error);
 
   public: void unload(PtrWord id);
@@ -0,0 +1,631 @@
+/**
+ * @file Core/Main/ParseCache.cpp
+ * Contains the implementation of class Core::Main::ParseCache.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#ifdef WINDOWS
+  #include <direct.h>
+#endif
+
+namespace Core::Main
+{
+
+//==============================================================================
+// Constructor
+
+ParseCache::ParseCache()
+{
+  Char const *enabledEnv = getenv(S("ALUSUS_PARSE_CACHE"));
+  if (enabledEnv != 0 && compareStr(enabledEnv, S("1")) == 0) this->enabled = true;
+
+  Char const *dirEnv = getenv(S("ALUSUS_PARSE_CACHE_DIR"));
+  if (dirEnv != 0 && *dirEnv != C('\0')) {
+    this->setDirectory(dirEnv);
+  } else {
+    Char const *cacheHome = getenv(S("XDG_CACHE_HOME"));
+    if (cacheHome != 0 && *cacheHome != C('\0')) {
+      this->setDirectory((Str(cacheHome) + S("/alusus/parse_cache/")).getBuf());
+    } else {
+      Char const *home = getenv(S("HOME"));
+      if (home != 0 && *home != C('\0')) {
+        this->setDirectory((Str(home) + S("/.cache/alusus/parse_cache/")).getBuf());
+      }
+      // Otherwise we don't know where to keep the cache and it stays disabled.
+
+    }
+  }
+}
+
+
+//==============================================================================
+// Configuration Functions
+
+void ParseCache::setDirectory(Char const *dir)
+{
+  this->directory = dir;
+  if (this->directory.getLength() > 0 && this->directory(this->directory.getLength() - 1) != C('/')) {
+    this->directory += C('/');
+  }
+}
+
+
+//==============================================================================
+// Recording Functions
+
+void ParseCache::beginRecording(Bool active)
+{
+  this->recordings.push_back(Recording(active));
+}
+
+
+Bool ParseCache::endRecording(std::string &records)
+{
+  if (this->recordings.empty()) {
+    throw EXCEPTION(GenericException, S("No recording is in progress."));
+  }
+  auto &recording = this->recordings.back();
+  Bool cacheable = recording.active && recording.cacheable;
+  if (cacheable) records.swap(recording.records);
+  this->recordings.pop_back();
+  return cacheable;
+}
+
+
+void ParseCache::markUncacheable()
+{
+  if (this->recordings.empty()) return;
+  this->recordings.back().cacheable = false;
+}
+
+
+void ParseCache::record(RecordType type, TiObject *data)
+{
+  if (this->recordings.empty()) return;
+  auto &recording = this->recordings.back();
+  if (!recording.active || !recording.cacheable) return;
+  try {
+    recording.records += static_cast<Char>(type.val);
+    ParseCache::writeObject(recording, data);
+  } catch (Exception &e) {
+    LOG(LogLevel::PARSER_MAJOR, S("Parse results can't be cached: ") << e.getVerboseErrorMessage());
+    recording.cacheable = false;
+    recording.records.clear();
+  }
+}
+
+
+//==============================================================================
+// Storage Functions
+
+Bool ParseCache::load(
+  Char const *filename, Char const *key, std::string &rawRecords, std::vector<Record> &records
+) {
+  std::ifstream fin(ParseCache::getCacheFilename(filename).getBuf(), std::ios::binary);
+  if (fin.fail()) return false;
+  std::string content((std::istreambuf_iterator<Char>(fin)), std::istreambuf_iterator<Char>());
+
+  try {
+    // Validate the header.
+    Reader header(&content);
+    if (ParseCache::readStr(header) != filename) return false;
+    if (ParseCache::readStr(header) != key) return false;
+
+    rawRecords = content.substr(header.pos);
+  } catch (Exception &e) {
+    LOG(LogLevel::PARSER_MAJOR, S("Invalid parse cache entry for ") << filename << S(": ")
+        << e.getVerboseErrorMessage());
+    return false;
+  }
+
+  if (!ParseCache::readRecords(rawRecords, records)) {
+    rawRecords.clear();
+    return false;
+  }
+  return true;
+}
+
+
+Bool ParseCache::readRecords(std::string const &rawRecords, std::vector<Record> &records)
+{
+  try {
+    Reader reader(&rawRecords);
+    while (reader.pos < rawRecords.size()) {
+      Record record;
+      record.type = static_cast<RecordType::_RecordType>(rawRecords[reader.pos++]);
+      if (record.type != RecordType::ELEMENT && record.type != RecordType::IMPORT) {
+        throw EXCEPTION(GenericException, S("Invalid record type."));
+      }
+      record.data = ParseCache::readObject(reader);
+      records.push_back(record);
+    }
+  } catch (Exception &e) {
+    LOG(LogLevel::PARSER_MAJOR, S("Invalid parse cache records: ") << e.getVerboseErrorMessage());
+    records.clear();
+    return false;
+  }
+  return true;
+}
+
+
+void ParseCache::store(Char const *filename, Char const *key, std::string const &rawRecords)
+{
+  // Make sure the cache directory exists.
+  for (Int i = 1; i < this->directory.getLength(); ++i) {
+    if (this->directory(i) == C('/')) {
+      Str subdir(this->directory, 0, i);
+      #ifdef WINDOWS
+        _mkdir(subdir.getBuf());
+      #else
+        mkdir(subdir.getBuf(), 0755);
+      #endif
+    }
+  }
+
+  Recording header(true);
+  ParseCache::writeStr(header, filename);
+  ParseCache::writeStr(header, key);
+
+  // Write into a temp file then rename it to avoid leaving incomplete entries behind.
+  Str cacheFilename = this->getCacheFilename(filename);
+  Str tempFilename = cacheFilename + S(".tmp");
+  {
+    std::ofstream fout(tempFilename.getBuf(), std::ios::binary | std::ios::trunc);
+    if (fout.fail()) return;
+    fout.write(header.records.data(), header.records.size());
+    fout.write(rawRecords.data(), rawRecords.size());
+    if (fout.fail()) {
+      fout.close();
+      remove(tempFilename.getBuf());
+      return;
+    }
+  }
+  if (rename(tempFilename.getBuf(), cacheFilename.getBuf()) != 0) remove(tempFilename.getBuf());
+}
+
+
+Str ParseCache::getCacheFilename(Char const *filename) const
+{
+  Char hex[17];
+  snprintf(hex, sizeof(hex), S("%016lx"), ParseCache::computeHash(filename, getStrLen(filename)));
+  return this->directory + hex + S(".cache");
+}
+
+
+LongWord ParseCache::computeHash(Char const *data, Word size, LongWord hash)
+{
+  for (Word i = 0; i < size; ++i) {
+    hash ^= static_cast<Byte>(data[i]);
+    hash *= 1099511628211ul;
+  }
+  return hash;
+}
+
+
+LongWord ParseCache::computeTreeHash(TiObject *obj, LongWord hash)
+{
+  if (obj == 0) return ParseCache::computeHash(S("n"), 1, hash);
+
+  auto typeName = obj->getMyTypeInfo()->getUniqueName();
+  hash = ParseCache::computeHash(typeName.getBuf(), typeName.getLength(), hash);
+
+  if (obj->isDerivedFrom<TiInt>()) {
+    Int value = static_cast<TiInt*>(obj)->get();
+    hash = ParseCache::computeHash(reinterpret_cast<Char const*>(&value), sizeof(value), hash);
+  } else if (obj->isDerivedFrom<TiWord>()) {
+    Word value = static_cast<TiWord*>(obj)->get();
+    hash = ParseCache::computeHash(reinterpret_cast<Char const*>(&value), sizeof(value), hash);
+  } else if (obj->isDerivedFrom<TiStr>()) {
+    Char const *value = static_cast<TiStr*>(obj)->get();
+    hash = ParseCache::computeHash(value, getStrLen(value) + 1, hash);
+  } else if (obj->isDerivedFrom<TiBool>()) {
+    hash = ParseCache::computeHash(static_cast<TiBool*>(obj)->get() ? S("1") : S("0"), 1, hash);
+  } else if (obj->isDerivedFrom<Data::Node>()) {
+    auto bindings = ti_cast<Binding>(obj);
+    if (bindings != 0) {
+      for (Int i = 0; i < bindings->getMemberCount(); ++i) {
+        auto key = bindings->getMemberKey(i);
+        hash = ParseCache::computeHash(key.getBuf(), key.getLength() + 1, hash);
+        auto member = bindings->getMember(i);
+        auto holdMode = bindings->getMemberHoldMode(i);
+        if (holdMode == HoldMode::VALUE && member->isDerivedFrom<TiWord>() && (key == S("prodId") || key == S("id"))) {
+          // IDs are generated at run time, so we need to hash their descriptions instead.
+          auto desc = ID_GENERATOR->getDesc(static_cast<TiWord*>(member)->get());
+          hash = ParseCache::computeHash(desc.getBuf(), desc.getLength() + 1, hash);
+        } else if (holdMode == HoldMode::VALUE || holdMode == HoldMode::SHARED_REF) {
+          hash = ParseCache::computeTreeHash(member, hash);
+        }
+      }
+    }
+
+    auto mapContainer = ti_cast<MapContaining<TiObject>>(obj);
+    if (mapContainer != 0) {
+      for (Int i = 0; i < mapContainer->getElementCount(); ++i) {
+        auto key = mapContainer->getElementKey(i);
+        hash = ParseCache::computeHash(key.getBuf(), key.getLength() + 1, hash);
+        hash = ParseCache::computeTreeHash(mapContainer->getElement(i), hash);
+      }
+    } else {
+      auto container = ti_cast<Containing<TiObject>>(obj);
+      if (container != 0) {
+        for (Int i = 0; i < container->getElementCount(); ++i) {
+          hash = ParseCache::computeTreeHash(container->getElement(i), hash);
+        }
+      }
+    }
+  }
+
+  return hash;
+}
+
+
+Bool ParseCache::compareObjects(TiObject *obj1, TiObject *obj2)
+{
+  if (obj1 == 0 || obj2 == 0) return obj1 == obj2;
+  if (obj1->getMyTypeInfo() != obj2->getMyTypeInfo()) return false;
+
+  if (obj1->isA<Data::SourceLocationRecord>()) {
+    auto sl1 = static_cast<Data::SourceLocationRecord*>(obj1);
+    auto sl2 = static_cast<Data::SourceLocationRecord*>(obj2);
+    return sl1->filename == sl2->filename && sl1->line == sl2->line && sl1->column == sl2->column;
+  } else if (obj1->isA<Data::SourceLocationStack>()) {
+    auto stack1 = static_cast<Data::SourceLocationStack*>(obj1);
+    auto stack2 = static_cast<Data::SourceLocationStack*>(obj2);
+    if (stack1->getCount() != stack2->getCount()) return false;
+    for (Int i = 0; i < stack1->getCount(); ++i) {
+      if (!ParseCache::compareObjects(stack1->get(i).get(), stack2->get(i).get())) return false;
+    }
+    return true;
+  } else if (obj1->isDerivedFrom<TiInt>()) {
+    return static_cast<TiInt*>(obj1)->get() == static_cast<TiInt*>(obj2)->get();
+  } else if (obj1->isDerivedFrom<TiWord>()) {
+    return static_cast<TiWord*>(obj1)->get() == static_cast<TiWord*>(obj2)->get();
+  } else if (obj1->isDerivedFrom<TiStr>()) {
+    return compareStr(static_cast<TiStr*>(obj1)->get(), static_cast<TiStr*>(obj2)->get()) == 0;
+  } else if (obj1->isDerivedFrom<TiBool>()) {
+    return static_cast<TiBool*>(obj1)->get() == static_cast<TiBool*>(obj2)->get();
+  } else if (!obj1->isDerivedFrom<Data::Node>()) {
+    return false;
+  }
+
+  auto bindings1 = ti_cast<Binding>(obj1);
+  auto bindings2 = ti_cast<Binding>(obj2);
+  if (bindings1 != 0) {
+    if (bindings1->getMemberCount() != bindings2->getMemberCount()) return false;
+    for (Int i = 0; i < bindings1->getMemberCount(); ++i) {
+      auto holdMode = bindings1->getMemberHoldMode(i);
+      if (holdMode != HoldMode::VALUE && holdMode != HoldMode::SHARED_REF) continue;
+      if (!ParseCache::compareObjects(bindings1->getMember(i), bindings2->getMember(i))) return false;
+    }
+  }
+
+  auto mapContainer1 = ti_cast<MapContaining<TiObject>>(obj1);
+  auto mapContainer2 = ti_cast<MapContaining<TiObject>>(obj2);
+  if (mapContainer1 != 0) {
+    if (mapContainer1->getElementCount() != mapContainer2->getElementCount()) return false;
+    for (Int i = 0; i < mapContainer1->getElementCount(); ++i) {
+      if (mapContainer1->getElementKey(i) != mapContainer2->getElementKey(i)) return false;
+      if (!ParseCache::compareObjects(mapContainer1->getElement(i), mapContainer2->getElement(i))) return false;
+    }
+    return true;
+  }
+
+  auto container1 = ti_cast<Containing<TiObject>>(obj1);
+  auto container2 = ti_cast<Containing<TiObject>>(obj2);
+  if (container1 != 0) {
+    if (container1->getElementCount() != container2->getElementCount()) return false;
+    for (Int i = 0; i < container1->getElementCount(); ++i) {
+      if (!ParseCache::compareObjects(container1->getElement(i), container2->getElement(i))) return false;
+    }
+  }
+
+  return true;
+}
+
+
+//==============================================================================
+// Serialization Functions
+
+void ParseCache::writeWord(std::string &buffer, LongWord value)
+{
+  while (value >= 0x80) {
+    buffer += static_cast<Char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  buffer += static_cast<Char>(value);
+}
+
+
+void ParseCache::writeStr(Recording &recording, Char const *str)
+{
+  // Strings are written once, then referenced by their index.
+  auto iter = recording.strings.find(str);
+  if (iter != recording.strings.end()) {
+    ParseCache::writeWord(recording.records, iter->second);
+  } else {
+    Word index = recording.strings.size();
+    recording.strings[str] = index;
+    ParseCache::writeWord(recording.records, index);
+    Word length = getStrLen(str);
+    ParseCache::writeWord(recording.records, length);
+    recording.records.append(str, length);
+  }
+}
+
+
+void ParseCache::writeObject(Recording &recording, TiObject *obj)
+{
+  auto &buffer = recording.records;
+
+  if (obj == 0) {
+    buffer += C('n');
+  } else if (obj->isA<Data::SourceLocationRecord>()) {
+    buffer += C('r');
+    ParseCache::writeSourceLocationRecord(recording, static_cast<Data::SourceLocationRecord*>(obj));
+  } else if (obj->isA<Data::SourceLocationStack>()) {
+    auto stack = static_cast<Data::SourceLocationStack*>(obj);
+    buffer += C('k');
+    ParseCache::writeWord(buffer, stack->getCount());
+    for (Int i = 0; i < stack->getCount(); ++i) {
+      ParseCache::writeSourceLocationRecord(recording, stack->get(i).get());
+    }
+  } else if (obj->isDerivedFrom<TiInt>()) {
+    buffer += C('I');
+    ParseCache::writeWord(buffer, static_cast<LongWord>(static_cast<TiInt*>(obj)->get()));
+  } else if (obj->isDerivedFrom<TiWord>()) {
+    buffer += C('W');
+    ParseCache::writeWord(buffer, static_cast<TiWord*>(obj)->get());
+  } else if (obj->isDerivedFrom<TiStr>()) {
+    buffer += C('S');
+    ParseCache::writeStr(recording, static_cast<TiStr*>(obj)->get());
+  } else if (obj->isDerivedFrom<TiBool>()) {
+    buffer += C('B');
+    buffer += static_cast<TiBool*>(obj)->get() ? C('1') : C('0');
+  } else if (obj->isDerivedFrom<Data::Node>()) {
+    auto typeInfo = obj->getMyTypeInfo();
+    if (typeInfo->getFactory() == 0) {
+      throw EXCEPTION(GenericException,
+        (Str(S("Type is missing an object factory: ")) + typeInfo->getUniqueName()).getBuf()
+      );
+    }
+    buffer += C('o');
+    ParseCache::writeStr(recording, typeInfo->getUniqueName());
+
+    auto bindings = ti_cast<Binding>(obj);
+    if (bindings != 0) {
+      ParseCache::writeWord(buffer, bindings->getMemberCount());
+      for (Int i = 0; i < bindings->getMemberCount(); ++i) {
+        auto key = bindings->getMemberKey(i);
+        ParseCache::writeStr(recording, key);
+        auto member = bindings->getMember(i);
+        auto holdMode = bindings->getMemberHoldMode(i);
+        if (holdMode == HoldMode::SHARED_REF) {
+          ParseCache::writeObject(recording, member);
+        } else if (holdMode != HoldMode::VALUE) {
+          if (member != 0) {
+            throw EXCEPTION(GenericException, (Str(S("Unsupported member hold mode: ")) + key.getBuf()).getBuf());
+          }
+          buffer += C('n');
+        } else if (member->isDerivedFrom<TiWord>() && (key == S("prodId") || key == S("id"))) {
+          // IDs are generated at run time, so we need to store their descriptions instead.
+          buffer += C('d');
+          ParseCache::writeStr(recording, ID_GENERATOR->getDesc(static_cast<TiWord*>(member)->get()));
+        } else {
+          ParseCache::writeObject(recording, member);
+        }
+      }
+    }
+
+    auto dynMapContainer = ti_cast<DynamicMapContaining<TiObject>>(obj);
+    if (dynMapContainer != 0) {
+      ParseCache::writeWord(buffer, dynMapContainer->getElementCount());
+      for (Int i = 0; i < dynMapContainer->getElementCount(); ++i) {
+        ParseCache::writeStr(recording, dynMapContainer->getElementKey(i));
+        ParseCache::writeObject(recording, dynMapContainer->getElement(i));
+      }
+    }
+
+    auto dynContainer = ti_cast<DynamicContaining<TiObject>>(obj);
+    if (dynContainer != 0) {
+      ParseCache::writeWord(buffer, dynContainer->getElementCount());
+      for (Int i = 0; i < dynContainer->getElementCount(); ++i) {
+        ParseCache::writeObject(recording, dynContainer->getElement(i));
+      }
+    }
+
+    auto container = ti_cast<Containing<TiObject>>(obj);
+    if (dynContainer == 0 && dynMapContainer == 0 && container != 0) {
+      ParseCache::writeWord(buffer, container->getElementCount());
+      for (Int i = 0; i < container->getElementCount(); ++i) {
+        ParseCache::writeObject(recording, container->getElement(i));
+      }
+    }
+  } else {
+    throw EXCEPTION(GenericException,
+      (Str(S("Unsupported object type: ")) + obj->getMyTypeInfo()->getUniqueName()).getBuf()
+    );
+  }
+}
+
+
+void ParseCache::writeSourceLocationRecord(Recording &recording, Data::SourceLocationRecord *sl)
+{
+  ParseCache::writeStr(recording, sl->filename);
+  ParseCache::writeWord(recording.records, sl->line);
+  ParseCache::writeWord(recording.records, sl->column);
+}
+
+
+LongWord ParseCache::readWord(Reader &reader)
+{
+  LongWord value = 0;
+  Int shift = 0;
+  while (true) {
+    if (reader.pos >= reader.buffer->size()) {
+      throw EXCEPTION(GenericException, S("Unexpected end of data."));
+    }
+    Byte b = static_cast<Byte>((*reader.buffer)[reader.pos++]);
+    value |= static_cast<LongWord>(b & 0x7F) << shift;
+    if ((b & 0x80) == 0) break;
+    shift += 7;
+  }
+  return value;
+}
+
+
+Str ParseCache::readStr(Reader &reader)
+{
+  Word index = ParseCache::readWord(reader);
+  if (index < reader.strings.size()) return reader.strings[index];
+  if (index > reader.strings.size()) {
+    throw EXCEPTION(GenericException, S("Invalid string index."));
+  }
+  Word length = ParseCache::readWord(reader);
+  if (reader.pos + length > reader.buffer->size()) {
+    throw EXCEPTION(GenericException, S("Unexpected end of data."));
+  }
+  reader.strings.push_back(Str(reader.buffer->data() + reader.pos, length));
+  reader.pos += length;
+  return reader.strings.back();
+}
+
+
+TioSharedPtr ParseCache::readObject(Reader &reader)
+{
+  if (reader.pos >= reader.buffer->size()) {
+    throw EXCEPTION(GenericException, S("Unexpected end of data."));
+  }
+  Char tag = (*reader.buffer)[reader.pos++];
+  switch (tag) {
+    case C('n'):
+      return TioSharedPtr::null;
+
+    case C('r'):
+      return ParseCache::readSourceLocationRecord(reader);
+
+    case C('k'): {
+      auto stack = newSrdObj<Data::SourceLocationStack>();
+      Word count = ParseCache::readWord(reader);
+      for (Word i = 0; i < count; ++i) stack->add(ParseCache::readSourceLocationRecord(reader));
+      return stack;
+    }
+
+    case C('I'):
+      return TiInt::create(static_cast<Int>(ParseCache::readWord(reader)));
+
+    case C('W'):
+      return TiWord::create(ParseCache::readWord(reader));
+
+    case C('S'):
+      return TiStr::create(ParseCache::readStr(reader).getBuf());
+
+    case C('B'):
+      if (reader.pos >= reader.buffer->size()) {
+        throw EXCEPTION(GenericException, S("Unexpected end of data."));
+      }
+      return TiBool::create((*reader.buffer)[reader.pos++] == C('1'));
+
+    case C('o'): {
+      Str typeName = ParseCache::readStr(reader);
+      auto typeInfo = reinterpret_cast<ObjectTypeInfo const*>(GLOBAL_STORAGE->getObject(typeName));
+      if (typeInfo == 0 || typeInfo->getFactory() == 0) {
+        throw EXCEPTION(GenericException, (Str(S("Unknown object type: ")) + typeName).getBuf());
+      }
+      auto obj = typeInfo->getFactory()->createShared();
+
+      auto bindings = obj.ti_cast_get<Binding>();
+      if (bindings != 0) {
+        Word count = ParseCache::readWord(reader);
+        for (Word i = 0; i < count; ++i) {
+          Str key = ParseCache::readStr(reader);
+          Int index = bindings->findMemberIndex(key);
+          if (index == -1) throw EXCEPTION(GenericException, (Str(S("Unknown member: ")) + key).getBuf());
+          if (bindings->getMemberHoldMode(index) == HoldMode::VALUE) {
+            // Values are updated in place.
+            auto member = bindings->getMember(index);
+            if (reader.pos < reader.buffer->size() && (*reader.buffer)[reader.pos] == C('d')) {
+              ++reader.pos;
+              if (!member->isDerivedFrom<TiWord>()) {
+                throw EXCEPTION(GenericException, (Str(S("Invalid ID member: ")) + key).getBuf());
+              }
+              static_cast<TiWord*>(member)->set(ID_GENERATOR->getId(ParseCache::readStr(reader)));
+              continue;
+            }
+            auto value = ParseCache::readObject(reader);
+            if (value == 0) {
+              throw EXCEPTION(GenericException, (Str(S("Missing member value: ")) + key).getBuf());
+            } else if (value->isA<TiInt>() && member->isDerivedFrom<TiInt>()) {
+              static_cast<TiInt*>(member)->set(value.s_cast_get<TiInt>()->get());
+            } else if (value->isA<TiWord>() && member->isDerivedFrom<TiWord>()) {
+              static_cast<TiWord*>(member)->set(value.s_cast_get<TiWord>()->get());
+            } else if (value->isA<TiStr>() && member->isDerivedFrom<TiStr>()) {
+              static_cast<TiStr*>(member)->set(value.s_cast_get<TiStr>()->get());
+            } else if (value->isA<TiBool>() && member->isDerivedFrom<TiBool>()) {
+              *static_cast<TiBool*>(member) = value.s_cast_get<TiBool>()->get();
+            } else {
+              throw EXCEPTION(GenericException, (Str(S("Member type mismatch: ")) + key).getBuf());
+            }
+          } else {
+            auto value = ParseCache::readObject(reader);
+            if (value != 0) bindings->setMember(index, value.get());
+          }
+        }
+      }
+
+      auto dynMapContainer = obj.ti_cast_get<DynamicMapContaining<TiObject>>();
+      if (dynMapContainer != 0) {
+        Word count = ParseCache::readWord(reader);
+        for (Word i = 0; i < count; ++i) {
+          Str key = ParseCache::readStr(reader);
+          dynMapContainer->addElement(key, ParseCache::readObject(reader).get());
+        }
+      }
+
+      auto dynContainer = obj.ti_cast_get<DynamicContaining<TiObject>>();
+      if (dynContainer != 0) {
+        Word count = ParseCache::readWord(reader);
+        for (Word i = 0; i < count; ++i) {
+          dynContainer->addElement(ParseCache::readObject(reader).get());
+        }
+      }
+
+      auto container = obj.ti_cast_get<Containing<TiObject>>();
+      if (dynContainer == 0 && dynMapContainer == 0 && container != 0) {
+        Word count = ParseCache::readWord(reader);
+        if (count != container->getElementCount()) {
+          throw EXCEPTION(GenericException, (Str(S("Element count mismatch: ")) + typeName).getBuf());
+        }
+        for (Word i = 0; i < count; ++i) {
+          auto element = ParseCache::readObject(reader);
+          if (element != 0) container->setElement(i, element.get());
+        }
+      }
+
+      return obj;
+    }
+
+    default:
+      throw EXCEPTION(GenericException, S("Invalid object tag."));
+  }
+}
+
+
+SharedPtr<Data::SourceLocationRecord> ParseCache::readSourceLocationRecord(Reader &reader)
+{
+  auto sl = newSrdObj<Data::SourceLocationRecord>();
+  sl->filename = ParseCache::readStr(reader);
+  sl->line = ParseCache::readWord(reader);
+  sl->column = ParseCache::readWord(reader);
+  return sl;
+}
+
+} // namespace
@@ -0,0 +1,274 @@
+/**
+ * @file Core/Main/ParseCache.h
+ * Contains the header of class Core::Main::ParseCache.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_MAIN_PARSECACHE_H
+#define CORE_MAIN_PARSECACHE_H
+
+namespace Core::Main
+{
+
+/**
+ * @brief An on-disk cache of the results of parsing source files.
+ * @ingroup core_standard
+ *
+ * Parsing a source file results in a sequence of root elements that are added
+ * to the root scope, interleaved with import commands that are executed while
+ * parsing. While a file is being parsed this class records that sequence,
+ * serializing each element as soon as it's produced by the parser. If the
+ * file was parsed without notices the recording is saved on disk, keyed by
+ * the file's path and a key that combines the hash of the file's content,
+ * the loaded libraries, a hash of the grammar at the time the file is
+ * processed, and the Core's version. Next time the same file is imported with
+ * the same key the recorded sequence is replayed instead of lexing and parsing
+ * the file. The cache is disabled by default.<br>
+ * Elements are serialized generically using their bindings and containers,
+ * so any AST type with an object factory can be cached. Files that produce
+ * data that can't be serialized, or that use commands with side effects that
+ * can't be replayed, are not cached.
+ */
+class ParseCache : public TiObject
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(ParseCache, TiObject, "Core.Main", "Core", "alusus.org");
+
+
+  //============================================================================
+  // Data Types
+
+  public: s_enum(RecordType, ELEMENT = 'e', IMPORT = 'i');
+
+  /// A single deserialized record from a cached file.
+  public: struct Record
+  {
+    RecordType type;
+    TioSharedPtr data;
+  };
+
+  /// The recording of a single file currently being processed.
+  private: struct Recording
+  {
+    /// Whether this recording is capturing parsing results.
+    Bool active;
+    /// Whether the recorded data can be saved to the cache.
+    Bool cacheable = true;
+    std::string records;
+    std::unordered_map<std::string, Word> strings;
+
+    Recording(Bool a) : active(a) {}
+  };
+
+  /// State used when deserializing records.
+  private: struct Reader
+  {
+    std::string const *buffer;
+    Word pos = 0;
+    std::vector<Str> strings;
+
+    Reader(std::string const *b) : buffer(b) {}
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Bool enabled = false;
+
+  private: Bool verifying = false;
+
+  private: Str directory;
+
+  /**
+   * @brief The stack of recordings of files currently being processed.
+   *
+   * Imported files are processed while the importing file is still being
+   * parsed, so each file gets its own entry on this stack. Files that are
+   * replayed from the cache get inactive entries.
+   */
+  private: std::vector<Recording> recordings;
+
+
+  //============================================================================
+  // Constructor / Destructor
+
+  public: ParseCache();
+
+  public: virtual ~ParseCache()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// @name Configuration Functions
+  /// @{
+
+  /**
+   * @brief Set whether the cache is enabled.
+   *
+   * Disabled by default, unless the ALUSUS_PARSE_CACHE environment variable
+   * is set to 1. The cache stays disabled if no cache directory could be
+   * determined.
+   */
+  public: void setEnabled(Bool e)
+  {
+    this->enabled = e;
+  }
+
+  public: Bool isEnabled() const
+  {
+    return this->enabled && this->directory.getLength() > 0;
+  }
+
+  /**
+   * @brief Set whether to verify cache hits against a fresh parse.
+   *
+   * When verifying, cached files are still parsed and the resulting elements
+   * are compared with the cached ones using compareObjects(). A
+   * ParseCacheMismatchNotice is raised if they don't match, and the cache entry
+   * is replaced.
+   */
+  public: void setVerifying(Bool v)
+  {
+    this->verifying = v;
+  }
+
+  public: Bool isVerifying() const
+  {
+    return this->verifying;
+  }
+
+  /**
+   * @brief Set the directory in which cache files are saved.
+   *
+   * Defaults to the value of ALUSUS_PARSE_CACHE_DIR environment variable if
+   * set, otherwise to alusus/parse_cache/ inside the user's cache directory.
+   */
+  public: void setDirectory(Char const *dir);
+
+  public: Str const& getDirectory() const
+  {
+    return this->directory;
+  }
+
+  /// @}
+
+  /// @name Recording Functions
+  /// @{
+
+  /**
+   * @brief Start a new recording for a file that is about to be processed.
+   * @param active Whether the file is being parsed, as opposed to replayed.
+   */
+  public: void beginRecording(Bool active);
+
+  /**
+   * @brief End the recording of the file being processed.
+   * @param records Receives the recorded data.
+   * @return true if the recorded data can be saved to the cache.
+   */
+  public: Bool endRecording(std::string &records);
+
+  public: void recordElement(TiObject *data)
+  {
+    this->record(RecordType::ELEMENT, data);
+  }
+
+  public: void recordImport(TiObject *data)
+  {
+    this->record(RecordType::IMPORT, data);
+  }
+
+  /// Prevent the file currently being parsed from being cached.
+  public: void markUncacheable();
+
+  private: void record(RecordType type, TiObject *data);
+
+  /// @}
+
+  /// @name Storage Functions
+  /// @{
+
+  /**
+   * @brief Load the cached records of the given file.
+   *
+   * @param filename The full path of the file.
+   * @param key The key of the file's current content and environment.
+   * @param rawRecords Receives the raw recorded data.
+   * @param records Receives the deserialized records.
+   * @return false if there is no valid cache entry for the given file and
+   *         key, or if the entry couldn't be deserialized.
+   */
+  public: Bool load(
+    Char const *filename, Char const *key, std::string &rawRecords, std::vector<Record> &records
+  );
+
+  public: void store(Char const *filename, Char const *key, std::string const &rawRecords);
+
+  /**
+   * @brief Deserialize the given raw records.
+   * @return false if the records couldn't be deserialized.
+   */
+  public: static Bool readRecords(std::string const &rawRecords, std::vector<Record> &records);
+
+  private: Str getCacheFilename(Char const *filename) const;
+
+  /// Compute a 64-bit FNV-1a hash of the given data.
+  public: static LongWord computeHash(Char const *data, Word size, LongWord hash = 14695981039346656037ul);
+
+  /**
+   * @brief Compute a hash of the structure and values of the given tree.
+   *
+   * The tree is walked the same way it's serialized, but objects that can't be
+   * serialized contribute only their type names. This is used to hash the
+   * grammar, which includes parsing handlers.
+   */
+  public: static LongWord computeTreeHash(TiObject *obj, LongWord hash = 14695981039346656037ul);
+
+  /**
+   * @brief Compare two trees of serializable objects.
+   *
+   * Objects are compared by type, bindings and elements the same way they
+   * are serialized, including source locations.
+   */
+  public: static Bool compareObjects(TiObject *obj1, TiObject *obj2);
+
+  /// @}
+
+  /// @name Serialization Functions
+  /// @{
+
+  private: static void writeWord(std::string &buffer, LongWord value);
+
+  private: static void writeStr(Recording &recording, Char const *str);
+
+  private: static void writeObject(Recording &recording, TiObject *obj);
+
+  private: static void writeSourceLocationRecord(Recording &recording, Data::SourceLocationRecord *sl);
+
+  private: static LongWord readWord(Reader &reader);
+
+  private: static Str readStr(Reader &reader);
+
+  private: static TioSharedPtr readObject(Reader &reader);
+
+  private: static SharedPtr<Data::SourceLocationRecord> readSourceLocationRecord(Reader &reader);
+
+  /// @}
+
+}; // class
+
+} // namespace
+
+#endif
@@ -38,8 +38,10 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
 
   this->rootScopeHandler.setSeeker(&this->seeker);
   this->rootScopeHandler.setRootScope(this->rootScope);
+  this->rootScopeHandler.setParseCache(&this->parseCache);
 
   this->noticeSignal.connect(this->noticeSlot);
+  this->noticeSignal.relay(this->ownNoticeSignal);
 
   Data::Grammar::StandardFactory factory;
   factory.createGrammar(this->rootScope.get(), this, false);
@@ -96,9 +98,15 @@ SharedPtr<TiObject> RootManager::parseExpression(Char const *str)
 
 SharedPtr<TiObject> RootManager::processString(Char const *str, Char const *name)
 {
-  Processing::Engine engine(this->rootScope);
-  this->noticeSignal.relay(engine.noticeSignal);
-  return engine.processString(str, name);
+  auto engine = this->acquireEngine();
+  // Keep the results out of the recording of any file currently being parsed.
+  this->parseCache.beginRecording(false);
+  finally([=]() {
+    std::string unused;
+    this->parseCache.endRecording(unused);
+    this->releaseEngine(engine);
+  });
+  return engine->processString(str, name);
 }
 
 
@@ -131,9 +139,14 @@ SharedPtr<TiObject> RootManager::_processFile(Char const *fullPath, Bool allowRe
   }
 
   // Process the file.
-  Processing::Engine engine(this->rootScope);
-  this->noticeSignal.relay(engine.noticeSignal);
-  auto result = engine.processFile(fullPath);
+  auto engine = this->acquireEngine();
+  finally([=]() { this->releaseEngine(engine); });
+  SharedPtr<TiObject> result;
+  if (this->parseCache.isEnabled()) {
+    result = this->processCachedFile(engine.get(), fullPath);
+  } else {
+    result = engine->processFile(fullPath);
+  }
 
   // Remove the added path, if any.
   if (searchPath.getLength() > 0) {
@@ -144,11 +157,139 @@ SharedPtr<TiObject> RootManager::_processFile(Char const *fullPath, Bool allowRe
 }
 
 
+SharedPtr<TiObject> RootManager::processCachedFile(Processing::Engine *engine, Char const *path)
+{
+  // The given path may point to a shared buffer that gets overwritten by nested imports.
+  Str fullPathStr = path;
+  Char const *fullPath = fullPathStr.getBuf();
+
+  Str key;
+  if (!this->computeParseCacheKey(fullPath, key)) return engine->processFile(fullPath);
+
+  std::string cachedRecords;
+  std::vector<ParseCache::Record> records;
+  Bool cached = this->parseCache.load(fullPath, key, cachedRecords, records);
+
+  if (cached && !this->parseCache.isVerifying()) {
+    // Replay the cached results instead of parsing the file.
+    LOG(LogLevel::PARSER_MAJOR, S("Replaying cached parse results of: ") << fullPath);
+    this->parseCache.beginRecording(false);
+    finally([=]() { std::string unused; this->parseCache.endRecording(unused); });
+    return engine->replay([=,&records](Processing::Parser *parser, Processing::ParserState *state)->void {
+      this->replayParseCacheRecords(records, parser, state);
+    }, fullPath);
+  }
+
+  // Parse the file while recording the results. Files that raise notices aren't cached since the
+  // notices won't be raised again when replaying.
+  Int noticeCount = 0;
+  Slot<void, SharedPtr<Notices::Notice> const&> noticeCounter(
+    [&noticeCount](SharedPtr<Notices::Notice> const &notice)->void { ++noticeCount; }
+  );
+  engine->noticeSignal.connect(noticeCounter);
+  this->parseCache.beginRecording(true);
+  SharedPtr<TiObject> result;
+  std::string newRecords;
+  try {
+    result = engine->processFile(fullPath);
+  } catch (...) {
+    this->parseCache.endRecording(newRecords);
+    throw;
+  }
+  if (!this->parseCache.endRecording(newRecords) || noticeCount > 0) return result;
+
+  if (cached) {
+    // Compare the parsed elements with the cached ones.
+    std::vector<ParseCache::Record> newRecordObjects;
+    Bool matching = ParseCache::readRecords(newRecords, newRecordObjects) &&
+      newRecordObjects.size() == records.size();
+    for (Word i = 0; matching && i < records.size(); ++i) {
+      matching = newRecordObjects[i].type == records[i].type &&
+        ParseCache::compareObjects(newRecordObjects[i].data.get(), records[i].data.get());
+    }
+    if (matching) return result;
+    auto sourceLocation = newSrdObj<Data::SourceLocationRecord>();
+    sourceLocation->filename = fullPath;
+    sourceLocation->line = 1;
+    sourceLocation->column = 1;
+    this->ownNoticeSignal.emit(newSrdObj<Notices::ParseCacheMismatchNotice>(sourceLocation));
+  }
+  this->parseCache.store(fullPath, key, newRecords);
+
+  return result;
+}
+
+
+Bool RootManager::computeParseCacheKey(Char const *fullPath, Str &key)
+{
+  std::ifstream fin(fullPath, std::ios::binary);
+  if (fin.fail()) return false;
+  LongWord hash = ParseCache::computeHash(0, 0);
+  std::vector<Char> buffer(FILE_READ_BLOCK_SIZE);
+  while (fin) {
+    fin.read(buffer.data(), buffer.size());
+    if (fin.gcount() > 0) hash = ParseCache::computeHash(buffer.data(), fin.gcount(), hash);
+  }
+
+  // The loaded libraries and the current grammar determine the parsing results, so they are part
+  // of the key. The grammar can be modified by previously processed files, so we can't rely on
+  // the libraries alone.
+  Char hex[17];
+  snprintf(hex, sizeof(hex), S("%016lx"), hash);
+  key = Str(S("Alusus " ALUSUS_VERSION ALUSUS_REVISION " ")) + hex;
+  snprintf(hex, sizeof(hex), S("%016lx"), ParseCache::computeTreeHash(
+    Data::Grammar::getGrammarRoot(this->rootScope.get())
+  ));
+  key += S(" grammar ");
+  key += hex;
+  for (Word i = 0; i < this->libraryManager.getLibraryCount(); ++i) {
+    key += S(" ");
+    key += this->libraryManager.getGatewayAt(i)->getLibraryId();
+  }
+  return true;
+}
+
+
+void RootManager::replayParseCacheRecords(
+  std::vector<ParseCache::Record> const &records, Processing::Parser *parser, Processing::ParserState *state
+) {
+  auto importHandler = newSrdObj<Processing::Handlers::ImportParsingHandler>(this);
+  for (auto const &record : records) {
+    if (record.type == ParseCache::RecordType::ELEMENT) {
+      this->rootScopeHandler.addNewElement(record.data, parser, state);
+    } else {
+      importHandler->importData(record.data.get(), state);
+    }
+    parser->flushApprovedNotices();
+  }
+}
+
+
 SharedPtr<TiObject> RootManager::processStream(Processing::CharInStreaming *is, Char const *streamName)
 {
-  Processing::Engine engine(this->rootScope);
-  this->noticeSignal.relay(engine.noticeSignal);
-  return engine.processStream(is, streamName);
+  auto engine = this->acquireEngine();
+  this->parseCache.beginRecording(false);
+  finally([=]() {
+    std::string unused;
+    this->parseCache.endRecording(unused);
+    this->releaseEngine(engine);
+  });
+  return engine->processStream(is, streamName);
+}
+
+
+SharedPtr<Processing::Engine> RootManager::acquireEngine()
+{
+  SharedPtr<Processing::Engine> engine;
+  if (!this->idleEngines.empty()) {
+    engine = this->idleEngines.back();
+    this->idleEngines.pop_back();
+  } else {
+    engine = newSrdObj<Processing::Engine>(this->rootScope);
+    this->noticeSignal.relay(engine->noticeSignal);
+  }
+  engine->setLexerDfaEnabled(this->lexerDfaEnabled);
+  return engine;
 }
 
 
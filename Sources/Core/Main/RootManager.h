@@ -44,6 +44,7 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   private: RootScopeHandler rootScopeHandler;
   private: LibraryManager libraryManager;
+  private: ParseCache parseCache;
 
   private: SharedMap<TiObject> processedFiles;
 
@@ -52,9 +53,20 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   private: Data::Seeker seeker;
 
+  /**
+   * @brief Engines that are ready to process the next input.
+   *
+   * Engines keep their grammar derived data between inputs, so they are
+   * reused rather than recreated for each processed file. Files are imported
+   * while the importing file is still being parsed, so each nesting level
+   * gets its own engine.
+   */
+  private: std::vector<SharedPtr<Processing::Engine>> idleEngines;
+
   private: Int minNoticeSeverityEncountered = -1;
 
   private: Bool interactive;
+  private: Bool lexerDfaEnabled = true;
   private: Int processArgCount;
   private: Char const *const *processArgs;
   private: Str language;
@@ -66,6 +78,9 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
   /// Emitted when a build msg (error or warning) is generated.
   public: SignalRelay<void, SharedPtr<Notices::Notice> const&> noticeSignal;
 
+  /// Emits the notices raised by the root manager itself, relayed into noticeSignal.
+  private: Signal<void, SharedPtr<Notices::Notice> const&> ownNoticeSignal;
+
   private: Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot = {
     [=](SharedPtr<Notices::Notice> const &notice)->void
     {
@@ -83,6 +98,7 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   public: virtual ~RootManager()
   {
+    this->idleEngines.clear();
     this->libraryManager.unloadAll();
   }
 
@@ -115,6 +131,11 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return &this->seeker;
   }
 
+  public: virtual ParseCache* getParseCache()
+  {
+    return &this->parseCache;
+  }
+
   public: virtual SharedPtr<TiObject> parseExpression(Char const *str);
 
   public: virtual SharedPtr<TiObject> processString(Char const *str, Char const *name);
@@ -123,6 +144,21 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   private: virtual SharedPtr<TiObject> _processFile(Char const *fullPath, Bool allowReprocess = false);
 
+  private: SharedPtr<Processing::Engine> acquireEngine();
+
+  private: void releaseEngine(SharedPtr<Processing::Engine> const &engine)
+  {
+    this->idleEngines.push_back(engine);
+  }
+
+  private: SharedPtr<TiObject> processCachedFile(Processing::Engine *engine, Char const *fullPath);
+
+  private: Bool computeParseCacheKey(Char const *fullPath, Str &key);
+
+  private: void replayParseCacheRecords(
+    std::vector<ParseCache::Record> const &records, Processing::Parser *parser, Processing::ParserState *state
+  );
+
   public: virtual SharedPtr<TiObject> processStream(Processing::CharInStreaming *is, Char const *streamName);
 
   public: virtual Bool tryImportFile(Char const *filename, Str &errorDetails);
@@ -157,6 +193,23 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return this->interactive;
   }
 
+  /**
+   * @brief Set whether the lexers use the compiled DFA.
+   *
+   * When disabled the lexers interpret the grammar terms directly, which is
+   * slower but is useful for verifying the compiled DFA.
+   * @sa Processing::Lexer::setDfaEnabled()
+   */
+  public: void setLexerDfaEnabled(Bool enabled)
+  {
+    this->lexerDfaEnabled = enabled;
+  }
+
+  public: Bool isLexerDfaEnabled() const
+  {
+    return this->lexerDfaEnabled;
+  }
+
   public: void setProcessArgInfo(Int count, Char const *const *args)
   {
     this->processArgCount = count;
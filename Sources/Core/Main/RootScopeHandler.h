@@ -41,6 +41,8 @@ class RootScopeHandler : public TiObject, public DynamicBinding, public DynamicI
 
   private: SharedPtr<Data::Ast::Scope> rootScope;
 
+  private: ParseCache *parseCache = 0;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -85,6 +87,17 @@ class RootScopeHandler : public TiObject, public DynamicBinding, public DynamicI
     return this->seeker;
   }
 
+  /// Set the cache that records the elements added to the root scope, if any.
+  public: void setParseCache(ParseCache *c)
+  {
+    this->parseCache = c;
+  }
+
+  public: ParseCache* getParseCache() const
+  {
+    return this->parseCache;
+  }
+
   /// @}
 
   /// @name Main Functions
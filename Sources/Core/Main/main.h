@@ -95,6 +95,7 @@ Srl::String getModuleDirectory();
 
 #include "LibraryGateway.h"
 #include "LibraryManager.h"
+#include "ParseCache.h"
 #include "RootScopeHandler.h"
 #include "RootManager.h"
 
@@ -172,6 +172,9 @@ DEFINE_NOTICE(UnrecognizedErrorNotice, "Core.Notices", "Core", "alusus.org", "CG
 DEFINE_NOTICE(InvalidDumpArgNotice, "Core.Notices", "Core", "alusus.org", "CG1002", 1,
   "Invalid argument for 'dump_ast' command."
 );
+DEFINE_NOTICE(ParseCacheMismatchNotice, "Core.Notices", "Core", "alusus.org", "CG2005", 2,
+  "Cached parse results don't match the results of parsing the file. The cache entry was replaced."
+);
 
 } // namespace
 
@@ -11,6 +11,12 @@
 //==============================================================================
 
 #include "core.h"
+#ifndef WINDOWS
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
 
 namespace Core { namespace Processing
 {
@@ -18,57 +24,120 @@ namespace Core { namespace Processing
 //==============================================================================
 // Member Functions
 
-void Engine::initialize(SharedPtr<Data::Ast::Scope> const &rootScope)
+void Engine::initSignals()
 {
-  // Prepare the lexer.
-  this->lexer.initialize(rootScope);
   this->noticeSignal.relay(this->lexer.noticeSignal);
-
-  // Prepare the parser.
-  this->parser.initialize(rootScope);
   this->noticeSignal.relay(this->parser.noticeSignal);
   this->lexer.tokenGenerated.connect(this->parser.handleNewTokenSlot);
 }
 
 
-SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
+void Engine::initialize(SharedPtr<Data::Ast::Scope> const &rootScope)
 {
-  if (str == 0) {
-    throw EXCEPTION(InvalidArgumentException, S("str"), S("Cannot be null."), str);
-  }
+  this->rootScope = rootScope;
+  this->grammarRoot.reset();
+  this->prepareGrammar();
+}
 
-  this->parser.beginParsing();
 
-  // Start passing characters to the lexer.
+void Engine::prepareGrammar()
+{
+  auto grammarRoot = Data::Grammar::getGrammarRoot(this->rootScope.get());
+  if (grammarRoot == this->grammarRoot.get() && !this->grammarChanged && grammarRoot != 0) return;
 
-  Data::SourceLocationRecord sourceLocation;
-  sourceLocation.filename = name;
-  sourceLocation.line = 1;
-  sourceLocation.column = 1;
-  lexer.handleNewString(str, sourceLocation);
+  this->grammarChangeSlot.disconnect();
+  this->grammarMetaChangeSlot.disconnect();
 
-  auto endLine = sourceLocation.line;
-  auto endColumn = sourceLocation.column;
+  this->lexer.initialize(this->rootScope);
+  this->parser.clear();
+  this->parser.initialize(this->rootScope);
 
-  lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+  this->grammarRoot = getSharedPtr(grammarRoot);
+  this->grammarChanged = false;
+  this->watchGrammarModule(grammarRoot);
+}
 
-  sourceLocation.line = endLine;
-  sourceLocation.column = endColumn;
 
-  return this->parser.endParsing(sourceLocation);
+/**
+ * The lexer and the parser derive data from all the modules of the grammar,
+ * not only the root, so all nested modules are watched. Modules added later
+ * are added to an already watched module, which triggers reinitialization and
+ * watching the new modules.
+ */
+void Engine::watchGrammarModule(Data::Grammar::Module *module)
+{
+  module->changeNotifier.connect(this->grammarChangeSlot);
+  module->metaChangeNotifier.connect(this->grammarMetaChangeSlot);
+  for (Int i = 0; i < module->getCount(); ++i) {
+    auto childModule = ti_cast<Data::Grammar::Module>(module->getElement(i));
+    if (childModule != 0) this->watchGrammarModule(childModule);
+  }
 }
 
 
-SharedPtr<TiObject> Engine::processFile(Char const *filename)
+void Engine::beginProcessing()
 {
-  // Open the file.
-  std::ifstream fin(filename);
-  StdCharInStream finStream(&fin);
+  this->prepareGrammar();
+  this->lexer.reset();
+  this->parser.beginParsing();
+}
+
+
+SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
+{
+  if (str == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("str"), S("Cannot be null."), str);
+  }
+
+  return this->processChars(str, getStrLen(str), name);
+}
 
+
+/**
+ * Parses the given file. On systems that support it the file is memory mapped
+ * and passed to the lexer as a single block, otherwise the file is read in
+ * blocks of FILE_READ_BLOCK_SIZE bytes.
+ */
+SharedPtr<TiObject> Engine::processFile(Char const *filename)
+{
+  #ifndef WINDOWS
+    // Map the file into memory.
+    Int fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+      throw EXCEPTION(InvalidArgumentException, S("filename"), S("Could not open file."), filename);
+    }
+    struct stat fileStat;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0) {
+      data = mmap(0, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (data != MAP_FAILED) {
+      finally([=]() { munmap(data, fileStat.st_size); });
+      madvise(data, fileStat.st_size, MADV_SEQUENTIAL);
+      return this->processChars(static_cast<Char const*>(data), fileStat.st_size, filename);
+    }
+  #endif
+
+  // Read the file in blocks.
+  std::ifstream fin(filename, std::ios::binary);
   if (fin.fail()) {
     throw EXCEPTION(InvalidArgumentException, S("filename"), S("Could not open file."), filename);
   }
-  return this->processStream(&finStream, filename);
+
+  this->beginProcessing();
+
+  Data::SourceLocationRecord sourceLocation;
+  sourceLocation.filename = filename;
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  std::vector<Char> buffer(FILE_READ_BLOCK_SIZE);
+  while (fin) {
+    fin.read(buffer.data(), buffer.size());
+    if (fin.gcount() > 0) this->lexer.handleNewChars(buffer.data(), fin.gcount(), sourceLocation);
+  }
+
+  return this->endProcessing(sourceLocation);
 }
 
 
@@ -79,7 +148,7 @@ SharedPtr<TiObject> Engine::processStream(CharInStreaming *is, Char const *strea
     throw EXCEPTION(InvalidArgumentException, S("is"), S("Cannot be null."));
   }
 
-  parser.beginParsing();
+  this->beginProcessing();
 
   // Start passing characters to the lexer.
   Data::SourceLocationRecord sourceLocation;
@@ -92,15 +161,51 @@ SharedPtr<TiObject> Engine::processStream(CharInStreaming *is, Char const *strea
     c = is->get();
   }
 
+  return this->endProcessing(sourceLocation);
+}
+
+
+SharedPtr<TiObject> Engine::replay(
+  std::function<void(Parser *parser, ParserState *state)> const &replayer, Char const *name
+) {
+  this->beginProcessing();
+
+  replayer(&this->parser, this->parser.getState());
+
+  Data::SourceLocationRecord sourceLocation;
+  sourceLocation.filename = name;
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  return this->parser.endParsing(sourceLocation);
+}
+
+
+SharedPtr<TiObject> Engine::processChars(Char const *chars, Word count, Char const *name)
+{
+  this->beginProcessing();
+
+  // Pass the characters to the lexer.
+  Data::SourceLocationRecord sourceLocation;
+  sourceLocation.filename = name;
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  this->lexer.handleNewChars(chars, count, sourceLocation);
+
+  return this->endProcessing(sourceLocation);
+}
+
+
+SharedPtr<TiObject> Engine::endProcessing(Data::SourceLocationRecord &sourceLocation)
+{
   auto endLine = sourceLocation.line;
   auto endColumn = sourceLocation.column;
 
-  lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+  this->lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
 
   sourceLocation.line = endLine;
   sourceLocation.column = endColumn;
 
-  return parser.endParsing(sourceLocation);
+  return this->parser.endParsing(sourceLocation);
 }
 
 } } // namespace
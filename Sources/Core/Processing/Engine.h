@@ -33,6 +33,19 @@ class Engine : public TiObject
 
   private: Parser parser;
 
+  private: SharedPtr<Data::Ast::Scope> rootScope;
+
+  /**
+   * @brief The grammar root the lexer and the parser are currently initialized with.
+   *
+   * A strong reference is kept so that the address can't be reused by a new
+   * grammar root while this engine still refers to it.
+   */
+  private: SharedPtr<Data::Grammar::Module> grammarRoot;
+
+  /// Whether the grammar was modified since the lexer and parser were initialized.
+  private: Bool grammarChanged = false;
+
 
   //============================================================================
   // Signals
@@ -40,16 +53,32 @@ class Engine : public TiObject
   /// Emitted when a build msg (error or warning) is generated.
   public: SignalRelay<void, SharedPtr<Notices::Notice> const&> noticeSignal;
 
+  private: Slot<void, SharedMapBase<TiObject, Data::Node>*, ContentChangeOp, Int> grammarChangeSlot = {
+    [=](SharedMapBase<TiObject, Data::Node> *obj, ContentChangeOp op, Int index)->void
+    {
+      this->grammarChanged = true;
+    }
+  };
+
+  private: Slot<void, Data::Grammar::Module*, Word> grammarMetaChangeSlot = {
+    [=](Data::Grammar::Module *obj, Word element)->void
+    {
+      this->grammarChanged = true;
+    }
+  };
+
 
   //============================================================================
   // Constructors / Destructor
 
   public: Engine()
   {
+    this->initSignals();
   }
 
   public: Engine(SharedPtr<Data::Ast::Scope> const &rootScope)
   {
+    this->initSignals();
     this->initialize(rootScope);
   }
 
@@ -61,8 +90,38 @@ class Engine : public TiObject
   //============================================================================
   // Member Functions
 
+  private: void initSignals();
+
+  /**
+   * @brief Set the root scope from which the grammar is taken.
+   *
+   * The engine can be reused to process any number of inputs. The grammar
+   * derived data of the lexer and the parser, as well as their state buffers,
+   * are kept between inputs and are only rebuilt when the grammar root is
+   * replaced or modified.
+   */
   public: void initialize(SharedPtr<Data::Ast::Scope> const &rootScope);
 
+  /// Set whether the lexer uses the compiled DFA or interprets the grammar terms.
+  public: void setLexerDfaEnabled(Bool enabled)
+  {
+    this->lexer.setDfaEnabled(enabled);
+  }
+
+  public: Bool isLexerDfaEnabled() const
+  {
+    return this->lexer.isDfaEnabled();
+  }
+
+  /// Reinitialize the lexer and the parser if the grammar changed since the last input.
+  private: void prepareGrammar();
+
+  /// Watch the given grammar module and all its nested modules for changes.
+  private: void watchGrammarModule(Data::Grammar::Module *module);
+
+  /// Prepare the lexer and the parser for a new input.
+  private: void beginProcessing();
+
   /// Parse the given string and return any resulting parsing data.
   public: SharedPtr<TiObject> processString(Char const *str, Char const *name);
 
@@ -72,6 +131,23 @@ class Engine : public TiObject
   /// Parse the given stream and return any resulting parsing data.
   public: SharedPtr<TiObject> processStream(CharInStreaming *is, Char const *streamName);
 
+  /**
+   * @brief Replay previously recorded parsing results.
+   *
+   * Prepares the parser as if the given file is about to be parsed, then calls
+   * the given function, which feeds the recorded results to the parsing
+   * handlers using the parser and its state instead of parsing the file.
+   */
+  public: SharedPtr<TiObject> replay(
+    std::function<void(Parser *parser, ParserState *state)> const &replayer, Char const *name
+  );
+
+  /// Parse the given block of UTF-8 characters and return any resulting parsing data.
+  private: SharedPtr<TiObject> processChars(Char const *chars, Word count, Char const *name);
+
+  /// Send the file terminator to the lexer and finish parsing.
+  private: SharedPtr<TiObject> endProcessing(Data::SourceLocationRecord &sourceLocation);
+
 }; // class
 
 } // namespace
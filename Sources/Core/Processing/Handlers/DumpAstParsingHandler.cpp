@@ -24,6 +24,9 @@ void DumpAstParsingHandler::onProdEnd(Parser *parser, ParserState *state)
 {
   using SeekVerb = Data::Seeker::Verb;
 
+  // The dump is printed while parsing, so it can't be replayed from the cache.
+  this->rootManager->getParseCache()->markUncacheable();
+
   auto data = state->getData().ti_cast_get<Containing<TiObject>>()->getElement(1);
   ASSERT(data != 0);
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(data);
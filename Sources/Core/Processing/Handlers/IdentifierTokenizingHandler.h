@@ -59,6 +59,8 @@ class IdentifierTokenizingHandler : public TokenizingHandler
 
   public: void addKeyword(Char const *keyword)
   {
+    // The parser's decision caches are keyed by the symbols of keyword tokens, which are only looked up, not interned.
+    SymbolTable::getSingleton()->intern(keyword);
     if (this->keywords.count(keyword) == 0) this->keywords[keyword] = 1;
     else ++this->keywords[keyword];
   }
@@ -46,6 +46,14 @@ class ImportParsingHandler : public GenericParsingHandler
   /// Load the referenced library.
   public: virtual void onProdEnd(Parser *parser, ParserState *state);
 
+  /**
+   * @brief Execute the given parsed import command.
+   *
+   * Used by onProdEnd, and when replaying import commands from the parse
+   * cache.
+   */
+  public: void importData(TiObject *data, ParserState *state);
+
   private: Int tryImport(TiObject *astNode, Str &filenames, Str &errorDetails, ParserState *state);
 
 }; // class
@@ -20,11 +20,14 @@ namespace Core::Processing
 
 void Lexer::initialize(SharedPtr<Data::Ast::Scope> rootScope)
 {
-  this->clear();
-
-  this->states = new LexerState*[LEXER_STATES_ARRAY_MAX_SIZE];
-  this->nextStates = new LexerState*[LEXER_STATES_ARRAY_MAX_SIZE];
-  this->recycledStates = new LexerState*[LEXER_STATES_ARRAY_MAX_SIZE];
+  // Keep the state buffers, if already allocated, to be reused with the new grammar.
+  if (this->states == 0) {
+    this->states = new LexerState*[LEXER_STATES_ARRAY_MAX_SIZE];
+    this->nextStates = new LexerState*[LEXER_STATES_ARRAY_MAX_SIZE];
+    this->recycledStates = new LexerState*[LEXER_STATES_ARRAY_MAX_SIZE];
+  } else {
+    this->reset();
+  }
 
   // TODO: If we currently have a grammar, we need to unset it first.
   //if (this->production_definitions != 0) {
@@ -72,9 +75,7 @@ void Lexer::handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLoca
   convertStr(this->tempByteCharBuffer, this->tempByteCharCount, wideCharBuffer, 1, processedIn, processedOut);
   if (processedOut != 0) {
     // Conversion was successful. Send converted character to the buffer.
-    this->pushChar(wideCharBuffer[0], sourceLocation);
-    this->processBuffer();
-    computeNextCharPosition(wideCharBuffer[0], sourceLocation.line, sourceLocation.column);
+    this->handleNewWideChar(wideCharBuffer[0], sourceLocation);
     this->tempByteCharCount = 0;
   } else if (this->tempByteCharCount == 4) {
     throw EXCEPTION(GenericException,
@@ -93,8 +94,54 @@ void Lexer::handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLoca
  */
 void Lexer::handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation)
 {
-  for (Int i = 0; i < static_cast<Int>(strlen(inputStr)); i++) {
-    this->handleNewChar(inputStr[i], sourceLocation);
+  this->handleNewChars(inputStr, getStrLen(inputStr), sourceLocation);
+}
+
+
+/**
+ * Add a block of UTF-8 encoded characters to the input buffer and keep
+ * processing until no more characters are in the input buffer. Runs of ASCII
+ * characters are passed directly to the input buffer without going through
+ * the UTF-8 conversion, while multi byte sequences are converted one character
+ * at a time. A multi byte sequence that is split at the end of the block is
+ * buffered until the rest of the sequence is received in the next call.
+ *
+ * @param inputChars The block of characters to add to the input buffer.
+ * @param count The number of bytes in the given block.
+ * @param sourceLocation The source location of the first character in the
+ *                       block. This will be updated with the new location.
+ */
+void Lexer::handleNewChars(Char const *inputChars, Word count, Data::SourceLocationRecord &sourceLocation)
+{
+  Word i = 0;
+  // Complete any multi byte sequence left from a previous call.
+  while (this->tempByteCharCount > 0 && i < count) {
+    this->handleNewChar(inputChars[i++], sourceLocation);
+  }
+
+  while (i < count) {
+    // Send the run of ASCII characters directly to the buffer.
+    Word runEnd = i + getAsciiRunLength(inputChars + i, count - i);
+    for (; i < runEnd; ++i) {
+      this->handleNewWideChar(static_cast<WChar>(inputChars[i]), sourceLocation);
+    }
+    if (i == count) break;
+
+    // Convert the multi byte sequence.
+    WChar wideCharBuffer[1];
+    Int processedIn, processedOut;
+    Int length = count - i < 4 ? count - i : 4;
+    convertStr(inputChars + i, length, wideCharBuffer, 1, processedIn, processedOut);
+    if (processedOut != 0) {
+      this->handleNewWideChar(wideCharBuffer[0], sourceLocation);
+      i += processedIn;
+    } else if (length == 4) {
+      throw EXCEPTION(GenericException,
+                      S("Invalid input character sequence. Sequence could not be converted to wide characters."));
+    } else {
+      // The sequence is incomplete, so buffer it until the rest is received.
+      while (i < count) this->handleNewChar(inputChars[i++], sourceLocation);
+    }
   }
 }
 
@@ -143,8 +190,12 @@ Bool Lexer::pushChar(WChar ch, Data::SourceLocationRecord const &sl)
     if (this->currentProcessingIndex >= this->inputBuffer.getCharCount()) {
       // Check if there are any closed state.
       Int closedStateCount = 0;
-      for (Word i = 0; i < this->stateCount; i++) {
-        if (this->states[i]->getTokenLength() != 0) closedStateCount++;
+      if (this->dfa != 0) {
+        if (this->dfaTokenLength != 0) closedStateCount++;
+      } else {
+        for (Word i = 0; i < this->stateCount; i++) {
+          if (this->states[i]->getTokenLength() != 0) closedStateCount++;
+        }
       }
       if (closedStateCount == 0) {
         // There are no closed states, so replace the last character.
@@ -218,17 +269,32 @@ Int Lexer::process()
   WChar inputChar = this->inputBuffer.getChars()[this->currentProcessingIndex];
 
   // Check if this is the first character.
-  if (this->currentProcessingIndex == 0) {
-    this->processStartChar(inputChar);
+  if (this->currentProcessingIndex == 0) this->prepareDfa();
+
+  Int openStateCount = 0;
+  Int closedStateCount = 0;
+  if (this->dfa != 0) {
+    this->processDfaChar(inputChar);
+    if (this->dfaState != -1) openStateCount++;
+    if (this->dfaTokenLength != 0) closedStateCount++;
   } else {
-    this->processNextChar(inputChar);
-  }
+    if (this->currentProcessingIndex == 0) {
+      this->processStartChar(inputChar);
+    } else {
+      this->processNextChar(inputChar);
+    }
 
-  auto tempStates = this->states;
-  this->states = this->nextStates;
-  this->stateCount = this->nextStateCount;
-  this->nextStates = tempStates;
-  this->nextStateCount = 0;
+    auto tempStates = this->states;
+    this->states = this->nextStates;
+    this->stateCount = this->nextStateCount;
+    this->nextStates = tempStates;
+    this->nextStateCount = 0;
+
+    for (Word i = 0; i < this->stateCount; i++) {
+      if (this->states[i]->getTokenLength() == 0) openStateCount++;
+      else closedStateCount++;
+    }
+  }
 
   Int r = 0;
 
@@ -239,12 +305,6 @@ Int Lexer::process()
   //   If there are any closed states or if the input buffer contains only one character
   //   which is FILE_TERMINATOR, report whatever characters in the error buffer.
 
-  Int openStateCount = 0;
-  Int closedStateCount = 0;
-  for (Word i = 0; i < this->stateCount; i++) {
-    if (this->states[i]->getTokenLength() == 0) openStateCount++;
-    else closedStateCount++;
-  }
   if (openStateCount > 0) {
     // If the buffer is full and we have closed states, then we should choose one of them,
     // otherwise, wait until the open states are closed or deleted.
@@ -255,8 +315,9 @@ Int Lexer::process()
         newSrdObj<Data::SourceLocationRecord>(this->inputBuffer.getSourceLocation())
       ));
       // Choose one of the closed states.
-      Int i = this->selectBestToken();
-      Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(this->states[i]->getTokenDefIndex());
+      Int tokenDefIndex, tokenLength;
+      this->getBestToken(tokenDefIndex, tokenLength);
+      Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(tokenDefIndex);
       // Check if the chosen token is not an ignored token.
       TiInt *flags = this->grammarContext.getSymbolFlags(def);
       if (!((flags == 0 ? 0 : flags->get()) & Data::Grammar::SymbolFlags::IGNORED_TOKEN)) {
@@ -272,27 +333,24 @@ Int Lexer::process()
         TokenizingHandler *handler = ti_cast<TokenizingHandler>(def->getBuildHandler().get());
         if (handler == 0) {
           this->lastToken.setId(def->getId());
-          this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
+          this->lastToken.setText(this->inputBuffer.getChars(), tokenLength);
           this->lastToken.setSourceLocation(this->inputBuffer.getSourceLocation());
           this->lastToken.setAsKeyword(false);
         } else {
           handler->prepareToken(&this->lastToken, def->getId(), this->inputBuffer.getChars(),
-                                this->states[i]->getTokenLength(), this->inputBuffer.getSourceLocation());
+                                tokenLength, this->inputBuffer.getSourceLocation());
         }
         // Inform the caller that there is a new token.
         r |= 1;
       }
       // Reuse the remaining characters in the input buffer.
-      this->inputBuffer.remove(this->states[i]->getTokenLength());
+      this->inputBuffer.remove(tokenLength);
       // Set the processing index to -1 since the character we are currently processing is shifted
       // out of the buffer.
       this->currentProcessingIndex = -1;
       // Delete all the states.
-      for (Int i = 0; i < this->stateCount; ++i) {
-        this->recycledStates[this->recycledStateCount++] = this->states[i];
-      }
-      this->stateCount = 0;
-    } else if (closedStateCount > 0) {
+      this->recycleStates();
+    } else if (closedStateCount > 0 && this->dfa == 0) {
       Int bestToken = this->selectBestToken();
       if (closedStateCount > 1) {
         // Keep only the best closed state to conserve memory.
@@ -336,8 +394,9 @@ Int Lexer::process()
     }
   } else if (closedStateCount > 0) {
     // Choose one of the closed states.
-    Int i = this->selectBestToken();
-    Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(this->states[i]->getTokenDefIndex());
+    Int tokenDefIndex, tokenLength;
+    this->getBestToken(tokenDefIndex, tokenLength);
+    Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(tokenDefIndex);
     // Check if the chosen token is not an ignored token.
     TiInt *flags = this->grammarContext.getSymbolFlags(def);
     if (!((flags == 0 ? 0 : flags->get()) & Data::Grammar::SymbolFlags::IGNORED_TOKEN)) {
@@ -353,25 +412,22 @@ Int Lexer::process()
       TokenizingHandler *handler = ti_cast<TokenizingHandler>(def->getBuildHandler().get());
       if (handler == 0) {
         this->lastToken.setId(def->getId());
-        this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
+        this->lastToken.setText(this->inputBuffer.getChars(), tokenLength);
         this->lastToken.setSourceLocation(this->inputBuffer.getSourceLocation());
       } else {
         handler->prepareToken(&this->lastToken, def->getId(), this->inputBuffer.getChars(),
-                              this->states[i]->getTokenLength(), this->inputBuffer.getSourceLocation());
+                              tokenLength, this->inputBuffer.getSourceLocation());
       }
       // Inform the caller that there is a new token.
       r |= 1;
     }
     // Reuse the remaining characters in the input buffer.
-    this->inputBuffer.remove(this->states[i]->getTokenLength());
+    this->inputBuffer.remove(tokenLength);
     // Set the processing index to -1 since the character we are currently processing is shifted
     // out of the buffer.
     this->currentProcessingIndex = -1;
     // Delete all the states.
-    for (Int i = 0; i < this->stateCount; ++i) {
-      this->recycledStates[this->recycledStateCount++] = this->states[i];
-    }
-    this->stateCount = 0;
+    this->recycleStates();
   } else {
     // No states are still alive, so move the first character in the input buffer to the error
     // buffer and try again.
@@ -423,6 +479,58 @@ Int Lexer::process()
 }
 
 
+/**
+ * Prepares the compiled DFA of the lexer module for the next token. The DFA is
+ * compiled once per lexer module and cached in the module until the module's
+ * caches are cleared or its definitions change. If the DFA is disabled or the
+ * grammar can't be compiled, the lexer falls back to interpreting the grammar
+ * terms.
+ */
+void Lexer::prepareDfa()
+{
+  this->dfa.reset();
+  this->dfaState = -1;
+  this->dfaTokenDefIndex = -1;
+  this->dfaTokenLength = 0;
+  if (!this->dfaEnabled) return;
+
+  auto lexerModule = static_cast<Core::Data::Grammar::LexerModule*>(this->grammarContext.getModule());
+  auto dfa = lexerModule->getCompiledDfa().ti_cast<LexerDfa>();
+  if (dfa == 0 || dfa->getDefinitionsVersion() != lexerModule->getDefinitionsVersion()) {
+    dfa = LexerDfa::compile(&this->grammarContext);
+    lexerModule->setCompiledDfa(dfa);
+  }
+  if (dfa->isCompiled()) {
+    this->dfa = dfa;
+    this->dfaState = this->dfa->getStartState();
+  }
+}
+
+
+/**
+ * Processes the next character in the token by moving to the next state of the
+ * compiled DFA. If the new state accepts a token, that token becomes the best
+ * token found so far since it's longer than any previously found token.
+ *
+ * @param inputChar The next input character received from the input stream.
+ */
+void Lexer::processDfaChar(WChar inputChar)
+{
+  ASSERT(this->dfaState != -1);
+
+  LOG(LogLevel::LEXER_MID, S("Processing new character using DFA: '") << inputChar << S("'"));
+
+  this->dfaState = this->dfa->getNextState(this->dfaState, inputChar);
+  if (this->dfaState != -1) {
+    Int defIndex = this->dfa->getAcceptedDefIndex(this->dfaState);
+    if (defIndex != -1) {
+      this->dfaTokenDefIndex = defIndex;
+      this->dfaTokenLength = this->currentProcessingIndex + 1;
+    }
+  }
+}
+
+
 /**
  * Processes the first character in the token by searching the list of token
  * types and creating a state object for each token that can start with the
@@ -998,6 +1106,41 @@ Int Lexer::selectBestToken()
 }
 
 
+/**
+ * Get the token selected among the detected tokens, either by the DFA or by
+ * selectBestToken when interpreting the grammar terms.
+ *
+ * @param tokenDefIndex Receives the index of the selected token's definition.
+ * @param tokenLength Receives the length of the selected token.
+ */
+void Lexer::getBestToken(Int &tokenDefIndex, Int &tokenLength)
+{
+  if (this->dfa != 0) {
+    tokenDefIndex = this->dfaTokenDefIndex;
+    tokenLength = this->dfaTokenLength;
+  } else {
+    Int i = this->selectBestToken();
+    tokenDefIndex = this->states[i]->getTokenDefIndex();
+    tokenLength = this->states[i]->getTokenLength();
+  }
+}
+
+
+void Lexer::recycleStates()
+{
+  if (this->dfa != 0) {
+    this->dfaState = -1;
+    this->dfaTokenDefIndex = -1;
+    this->dfaTokenLength = 0;
+  } else {
+    for (Int i = 0; i < this->stateCount; ++i) {
+      this->recycledStates[this->recycledStateCount++] = this->states[i];
+    }
+    this->stateCount = 0;
+  }
+}
+
+
 /**
  * Clear the states stack and all other buffers to the state of the machine
  * before parsing started. Token and char group definitions will not be
@@ -1024,9 +1167,40 @@ void Lexer::clear()
     this->recycledStateCount = 0;
   }
 
+  this->dfaState = -1;
+  this->dfaTokenDefIndex = -1;
+  this->dfaTokenLength = 0;
+
+  this->inputBuffer.clear();
+  this->errorBuffer.clear();
+
+  this->currentProcessingIndex = 0;
+  this->currentTokenClamped = false;
+  this->lastToken.setId(UNKNOWN_ID);
+}
+
+
+void Lexer::reset()
+{
+  if (this->states == 0) return;
+
+  for (Int i = 0; i < this->stateCount; ++i) {
+    this->recycledStates[this->recycledStateCount++] = this->states[i];
+  }
+  this->stateCount = 0;
+  for (Int i = 0; i < this->nextStateCount; ++i) {
+    this->recycledStates[this->recycledStateCount++] = this->nextStates[i];
+  }
+  this->nextStateCount = 0;
+
+  this->dfaState = -1;
+  this->dfaTokenDefIndex = -1;
+  this->dfaTokenLength = 0;
+
   this->inputBuffer.clear();
   this->errorBuffer.clear();
 
+  this->tempByteCharCount = 0;
   this->currentProcessingIndex = 0;
   this->currentTokenClamped = false;
   this->lastToken.setId(UNKNOWN_ID);
@@ -80,6 +80,26 @@ class Lexer : public TiObject
   private: LexerState **recycledStates = 0;
   private: Word recycledStateCount = 0;
 
+  /// Whether to use the compiled DFA instead of interpreting the grammar terms.
+  private: Bool dfaEnabled = true;
+
+  /**
+   * @brief The compiled DFA used for the current token.
+   *
+   * This is null if the DFA is disabled or if the grammar couldn't be
+   * compiled, in which case the grammar terms are interpreted instead.
+   */
+  private: SharedPtr<LexerDfa> dfa;
+
+  /// The current DFA state, or -1 if no more characters can be accepted.
+  private: Int dfaState = -1;
+
+  /// The index of the definition of the best token found so far by the DFA.
+  private: Int dfaTokenDefIndex = -1;
+
+  /// The length of the best token found so far by the DFA, or 0 if none.
+  private: Int dfaTokenLength = 0;
+
   /**
    * @brief A temporary buffer used to buffer byte characters for conversion.
    * This buffer is used to buffer the received byte characters when multi
@@ -187,11 +207,30 @@ class Lexer : public TiObject
   public: void release()
   {
     this->clear();
+    this->dfa.reset();
     this->grammarRoot.reset();
     this->grammarContext.setRoot(0);
     this->grammarContext.setModule(0);
   }
 
+  /**
+   * @brief Set whether to use the compiled DFA.
+   *
+   * When enabled, the lexer compiles the token definitions of the grammar
+   * into a DFA (or reuses the one cached in the lexer module) and uses it
+   * instead of interpreting the grammar terms. If the grammar can't be
+   * compiled the lexer falls back to the interpreter. Enabled by default.
+   */
+  public: void setDfaEnabled(Bool enabled)
+  {
+    this->dfaEnabled = enabled;
+  }
+
+  public: Bool isDfaEnabled() const
+  {
+    return this->dfaEnabled;
+  }
+
   /// @}
 
   /// @name Parsing Operations
@@ -203,6 +242,17 @@ class Lexer : public TiObject
   /// Add a string of input characters to the input buffer and process them.
   public: void handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation);
 
+  /// Add a block of UTF-8 encoded input characters to the input buffer and process them.
+  public: void handleNewChars(Char const *inputChars, Word count, Data::SourceLocationRecord &sourceLocation);
+
+  /// Add a single decoded character to the input buffer and process it.
+  private: void handleNewWideChar(WChar inputChar, Data::SourceLocationRecord &sourceLocation)
+  {
+    this->pushChar(inputChar, sourceLocation);
+    this->processBuffer();
+    computeNextCharPosition(inputChar, sourceLocation.line, sourceLocation.column);
+  }
+
   /// Process all the characters currently waiting in the input buffer.
   private: void processBuffer();
 
@@ -218,6 +268,12 @@ class Lexer : public TiObject
   /// Process the next character in the token.
   private: void processNextChar(WChar inputChar);
 
+  /// Prepare the compiled DFA to be used for the next token, if possible.
+  private: void prepareDfa();
+
+  /// Process the given character using the compiled DFA.
+  private: void processDfaChar(WChar inputChar);
+
   /// Recursively apply the given character on the temp state.
   private: NextAction processState(LexerState *state, WChar inputChar, Int minLevel = 0);
 
@@ -231,9 +287,23 @@ class Lexer : public TiObject
   /// Select the best token among the detected tokens.
   private: Int selectBestToken();
 
+  /// Get the definition index and length of the best detected token.
+  private: void getBestToken(Int &tokenDefIndex, Int &tokenLength);
+
+  /// Drop all the states of the current token.
+  private: void recycleStates();
+
   /// Release all states and related data, but not definitions.
   public: void clear();
 
+  /**
+   * @brief Return to the state of the machine before parsing started.
+   *
+   * Unlike clear, this keeps the state buffers and the allocated states so
+   * they can be reused for the next input.
+   */
+  public: void reset();
+
   /// @}
 
   /// @name Utility Functions
@@ -0,0 +1,450 @@
+/**
+ * @file Core/Processing/LexerDfa.cpp
+ * Contains the implementation of Processing::LexerDfa.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#include <algorithm>
+#include <map>
+
+namespace Core::Processing
+{
+
+//==============================================================================
+// Compilation Functions
+
+/**
+ * Compiles the root token definitions of the context's current module into a
+ * DFA. The returned object is never null; if the grammar couldn't be compiled
+ * the returned object's isCompiled() will return false and the caller should
+ * fall back to interpreting the grammar terms.
+ */
+SharedPtr<LexerDfa> LexerDfa::compile(Data::Grammar::Context *context)
+{
+  auto dfa = newSrdObj<LexerDfa>();
+  auto module = context->getModule();
+  if (module == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("context"), S("Context's module is not set."));
+  }
+  auto lexerModule = ti_cast<Data::Grammar::LexerModule>(module);
+  if (lexerModule != 0) dfa->definitionsVersion = lexerModule->getDefinitionsVersion();
+  try {
+    dfa->compiled = dfa->build(context);
+  } catch (Exception &e) {
+    // Let the interpreter raise the grammar errors when it gets to them.
+    dfa->compiled = false;
+  }
+  if (!dfa->compiled) {
+    dfa->classStarts.clear();
+    dfa->transitions.clear();
+    dfa->acceptedDefIndexes.clear();
+  }
+  LOG(LogLevel::LEXER_MAJOR, S("Lexer DFA compilation ") << (dfa->compiled ? S("succeeded") : S("failed"))
+      << S(". States: ") << dfa->getStateCount() << S(", Classes: ") << dfa->getClassCount());
+  return dfa;
+}
+
+
+Bool LexerDfa::build(Data::Grammar::Context *context)
+{
+  auto module = context->getModule();
+  Nfa nfa;
+  nfa.classBoundaries.push_back(WCHAR_MIN);
+
+  // Generate the NFA of all root tokens.
+  std::vector<Int> acceptNodeDefIndexes;
+  std::vector<Bool> constDefs(module->getCount(), false);
+  std::vector<Bool> preferShorterDefs(module->getCount(), false);
+  Int rootNode = LexerDfa::addNfaNode(nfa);
+  for (Word i = 0; i < module->getCount(); ++i) {
+    auto def = ti_cast<Data::Grammar::SymbolDefinition>(module->getElement(i));
+    if (def == 0) continue;
+    TiInt *flags = context->getSymbolFlags(def);
+    Int flagsValue = flags == 0 ? 0 : flags->get();
+    if (!(flagsValue & Data::Grammar::SymbolFlags::ROOT_TOKEN)) continue;
+    if (def->getTerm() == 0) return false;
+    constDefs[i] = def->getTerm()->isA<Data::Grammar::ConstTerm>();
+    preferShorterDefs[i] = (flagsValue & Data::Grammar::SymbolFlags::PREFER_SHORTER) != 0;
+
+    nfa.currentDefIndex = i;
+    nfa.definitionStack.push_back(def);
+    Int startNode, endNode;
+    if (!LexerDfa::addNfaTerm(context, nfa, def->getTerm().get(), startNode, endNode)) return false;
+    nfa.definitionStack.pop_back();
+    nfa.nodes[rootNode].epsilons.push_back(startNode);
+    acceptNodeDefIndexes.resize(nfa.nodes.size(), -1);
+    acceptNodeDefIndexes[endNode] = i;
+  }
+  acceptNodeDefIndexes.resize(nfa.nodes.size(), -1);
+
+  // Compute the character classes.
+  std::sort(nfa.classBoundaries.begin(), nfa.classBoundaries.end());
+  nfa.classBoundaries.erase(
+    std::unique(nfa.classBoundaries.begin(), nfa.classBoundaries.end()), nfa.classBoundaries.end()
+  );
+  this->classStarts.clear();
+  for (auto boundary : nfa.classBoundaries) {
+    if (boundary <= WCHAR_MAX) this->classStarts.push_back(boundary);
+  }
+  Word classCount = this->classStarts.size();
+  for (Int c = 0; c < 128; ++c) {
+    auto iter = std::upper_bound(this->classStarts.begin(), this->classStarts.end(), static_cast<LongInt>(c));
+    this->asciiClasses[c] = static_cast<Int>(iter - this->classStarts.begin()) - 1;
+  }
+  for (auto &matcher : nfa.matchers) {
+    matcher.classes.resize(classCount);
+    for (Word k = 0; k < classCount; ++k) {
+      WChar ch = static_cast<WChar>(this->classStarts[k]);
+      if (matcher.unit != 0) matcher.classes[k] = Data::Grammar::matchCharGroup(ch, matcher.unit);
+      else matcher.classes[k] = matcher.ch == ch;
+    }
+  }
+
+  // Generate the DFA using subset construction. Each DFA state is keyed by its sorted set of NFA nodes followed
+  // by the index of the accepted token definition.
+  std::map<std::vector<Int>, Int> stateIds;
+  std::vector<std::vector<Int>> stateNodes;
+  this->transitions.clear();
+  this->acceptedDefIndexes.clear();
+
+  auto getState = [&](std::vector<Int> &nodes, Bool isStart)->Int {
+    LexerDfa::computeClosure(nfa, nodes);
+    // Find the token that selectBestToken would pick among the tokens ending here. Const tokens are preferred over
+    // other tokens, then tokens defined earlier in the module.
+    Int acceptedDefIndex = -1;
+    if (!isStart) {
+      for (auto node : nodes) {
+        Int defIndex = acceptNodeDefIndexes[node];
+        if (defIndex == -1 || defIndex == acceptedDefIndex) continue;
+        if (
+          acceptedDefIndex == -1 ||
+          (constDefs[defIndex] && !constDefs[acceptedDefIndex]) ||
+          (constDefs[defIndex] == constDefs[acceptedDefIndex] && defIndex < acceptedDefIndex)
+        ) {
+          acceptedDefIndex = defIndex;
+        }
+      }
+      // A PREFER_SHORTER token stops extending once it's the selected token.
+      if (acceptedDefIndex != -1 && preferShorterDefs[acceptedDefIndex]) {
+        nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [&](Int node)->Bool {
+          return nfa.nodes[node].defIndex == acceptedDefIndex;
+        }), nodes.end());
+      }
+    }
+    nodes.push_back(acceptedDefIndex);
+    auto iter = stateIds.find(nodes);
+    if (iter != stateIds.end()) return iter->second;
+    Int id = stateNodes.size();
+    stateIds[nodes] = id;
+    nodes.pop_back();
+    stateNodes.push_back(nodes);
+    this->acceptedDefIndexes.push_back(acceptedDefIndex);
+    return id;
+  };
+
+  std::vector<Int> nodes;
+  nodes.push_back(rootNode);
+  getState(nodes, true);
+  for (Word state = 0; state < stateNodes.size(); ++state) {
+    if (stateNodes.size() > LEXER_DFA_MAX_STATES) return false;
+    this->transitions.resize((state + 1) * classCount, -1);
+    for (Word k = 0; k < classCount; ++k) {
+      nodes.clear();
+      for (auto node : stateNodes[state]) {
+        auto &nfaNode = nfa.nodes[node];
+        if (nfaNode.matcher != -1 && nfa.matchers[nfaNode.matcher].classes[k]) nodes.push_back(nfaNode.next);
+      }
+      if (nodes.empty()) continue;
+      Int nextState = getState(nodes, false);
+      this->transitions[state * classCount + k] = nextState;
+    }
+  }
+
+  this->minimize();
+  return true;
+}
+
+
+Int LexerDfa::addNfaNode(Nfa &nfa)
+{
+  nfa.nodes.emplace_back();
+  nfa.nodes.back().defIndex = nfa.currentDefIndex;
+  return nfa.nodes.size() - 1;
+}
+
+
+/**
+ * Recursively generates the NFA nodes that match the given term. The function
+ * fails if the term uses features that can't be represented by a finite
+ * automaton, like recursive references, or if the generated NFA is too big.
+ *
+ * @return Returns true on success, false otherwise.
+ */
+Bool LexerDfa::addNfaTerm(
+  Data::Grammar::Context *context, Nfa &nfa, Data::Grammar::Term *term, Int &startNode, Int &endNode
+) {
+  if (nfa.nodes.size() > LEXER_DFA_MAX_NFA_NODES) return false;
+
+  if (term->isA<Data::Grammar::ConstTerm>()) {
+    auto &matchString = static_cast<Data::Grammar::ConstTerm*>(term)->getMatchString();
+    if (matchString.getLength() == 0) return false;
+    startNode = LexerDfa::addNfaNode(nfa);
+    endNode = startNode;
+    for (Int i = 0; i < matchString.getLength(); ++i) {
+      Int matcher = LexerDfa::addCharMatcher(nfa, matchString(i));
+      Int node = LexerDfa::addNfaNode(nfa);
+      nfa.nodes[endNode].matcher = matcher;
+      nfa.nodes[endNode].next = node;
+      endNode = node;
+    }
+    return true;
+  } else if (term->isA<Data::Grammar::CharGroupTerm>()) {
+    auto ref = static_cast<Data::Grammar::CharGroupTerm*>(term)->getCharGroupReference().get();
+    if (ref == 0) return false;
+    auto def = context->getReferencedCharGroup(ref);
+    if (def->getCharGroupUnit() == 0) return false;
+    Int matcher = LexerDfa::addCharGroupMatcher(nfa, def->getCharGroupUnit().get());
+    startNode = LexerDfa::addNfaNode(nfa);
+    endNode = LexerDfa::addNfaNode(nfa);
+    nfa.nodes[startNode].matcher = matcher;
+    nfa.nodes[startNode].next = endNode;
+    return true;
+  } else if (term->isA<Data::Grammar::ConcatTerm>()) {
+    auto list = static_cast<Data::Grammar::ConcatTerm*>(term)->getTerms().ti_cast_get<Data::Grammar::List>();
+    if (list == 0 || list->getCount() == 0) return false;
+    for (Word i = 0; i < list->getCount(); ++i) {
+      auto childTerm = ti_cast<Data::Grammar::Term>(list->getElement(i));
+      if (childTerm == 0) return false;
+      Int childStart, childEnd;
+      if (!LexerDfa::addNfaTerm(context, nfa, childTerm, childStart, childEnd)) return false;
+      if (i == 0) startNode = childStart;
+      else nfa.nodes[endNode].epsilons.push_back(childStart);
+      endNode = childEnd;
+    }
+    return true;
+  } else if (term->isA<Data::Grammar::AlternateTerm>()) {
+    auto list = static_cast<Data::Grammar::AlternateTerm*>(term)->getTerms().ti_cast_get<Data::Grammar::List>();
+    if (list == 0 || list->getCount() < 2) return false;
+    startNode = LexerDfa::addNfaNode(nfa);
+    endNode = LexerDfa::addNfaNode(nfa);
+    for (Word i = 0; i < list->getCount(); ++i) {
+      auto childTerm = ti_cast<Data::Grammar::Term>(list->getElement(i));
+      if (childTerm == 0) return false;
+      Int childStart, childEnd;
+      if (!LexerDfa::addNfaTerm(context, nfa, childTerm, childStart, childEnd)) return false;
+      nfa.nodes[startNode].epsilons.push_back(childStart);
+      nfa.nodes[childEnd].epsilons.push_back(endNode);
+    }
+    return true;
+  } else if (term->isA<Data::Grammar::MultiplyTerm>()) {
+    auto multiplyTerm = static_cast<Data::Grammar::MultiplyTerm*>(term);
+    auto childTerm = multiplyTerm->getTerm().ti_cast_get<Data::Grammar::Term>();
+    if (childTerm == 0) return false;
+    TiInt *minObj = multiplyTerm->getMin() == 0 ? 0 : context->getMultiplyTermMin(multiplyTerm);
+    TiInt *maxObj = multiplyTerm->getMax() == 0 ? 0 : context->getMultiplyTermMax(multiplyTerm);
+    Int min = minObj == 0 ? 0 : minObj->get();
+    Int max = maxObj == 0 ? -1 : maxObj->get();
+    startNode = LexerDfa::addNfaNode(nfa);
+    endNode = LexerDfa::addNfaNode(nfa);
+    // A term whose maximum is less than its minimum can never be matched.
+    if (max != -1 && max < min) return true;
+    Int node = startNode;
+    for (Int i = 0; i < min; ++i) {
+      Int childStart, childEnd;
+      if (!LexerDfa::addNfaTerm(context, nfa, childTerm, childStart, childEnd)) return false;
+      nfa.nodes[node].epsilons.push_back(childStart);
+      node = childEnd;
+    }
+    if (max == -1) {
+      Int childStart, childEnd;
+      if (!LexerDfa::addNfaTerm(context, nfa, childTerm, childStart, childEnd)) return false;
+      nfa.nodes[node].epsilons.push_back(childStart);
+      nfa.nodes[childEnd].epsilons.push_back(childStart);
+      nfa.nodes[childEnd].epsilons.push_back(endNode);
+    } else {
+      for (Int i = min; i < max; ++i) {
+        Int childStart, childEnd;
+        if (!LexerDfa::addNfaTerm(context, nfa, childTerm, childStart, childEnd)) return false;
+        nfa.nodes[node].epsilons.push_back(childStart);
+        nfa.nodes[node].epsilons.push_back(endNode);
+        node = childEnd;
+      }
+    }
+    nfa.nodes[node].epsilons.push_back(endNode);
+    return true;
+  } else if (term->isA<Data::Grammar::ReferenceTerm>()) {
+    auto ref = static_cast<Data::Grammar::ReferenceTerm*>(term)->getReference().get();
+    if (ref == 0) return false;
+    auto def = context->getReferencedSymbol(ref);
+    if (def->findOwner<Data::Grammar::Module>() != context->getModule()) return false;
+    if (def->getTerm() == 0) return false;
+    // Recursive definitions can't be represented by a finite automaton.
+    if (std::find(nfa.definitionStack.begin(), nfa.definitionStack.end(), def) != nfa.definitionStack.end()) {
+      return false;
+    }
+    nfa.definitionStack.push_back(def);
+    if (!LexerDfa::addNfaTerm(context, nfa, def->getTerm().get(), startNode, endNode)) return false;
+    nfa.definitionStack.pop_back();
+    return true;
+  } else {
+    return false;
+  }
+}
+
+
+Int LexerDfa::addCharMatcher(Nfa &nfa, WChar ch)
+{
+  auto iter = nfa.charMatchers.find(ch);
+  if (iter != nfa.charMatchers.end()) return iter->second;
+  nfa.matchers.push_back({ 0, ch });
+  nfa.classBoundaries.push_back(ch);
+  nfa.classBoundaries.push_back(static_cast<LongInt>(ch) + 1);
+  Int index = nfa.matchers.size() - 1;
+  nfa.charMatchers[ch] = index;
+  return index;
+}
+
+
+Int LexerDfa::addCharGroupMatcher(Nfa &nfa, Data::Grammar::CharGroupUnit *unit)
+{
+  auto iter = nfa.unitMatchers.find(unit);
+  if (iter != nfa.unitMatchers.end()) return iter->second;
+  nfa.matchers.push_back({ unit, 0 });
+  LexerDfa::collectClassBoundaries(nfa, unit);
+  Int index = nfa.matchers.size() - 1;
+  nfa.unitMatchers[unit] = index;
+  return index;
+}
+
+
+/**
+ * Add the codes at which the result of matching the given char group unit
+ * can change. Matching all characters between two consecutive boundaries
+ * yields the same result.
+ */
+void LexerDfa::collectClassBoundaries(Nfa &nfa, Data::Grammar::CharGroupUnit *unit)
+{
+  if (unit == 0) return;
+  if (unit->isA<Data::Grammar::SequenceCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::SequenceCharGroupUnit*>(unit);
+    nfa.classBoundaries.push_back(u->getStartCode());
+    nfa.classBoundaries.push_back(static_cast<LongInt>(u->getEndCode()) + 1);
+  } else if (unit->isA<Data::Grammar::RandomCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::RandomCharGroupUnit*>(unit);
+    for (Int i = 0; i < u->getCharListSize(); ++i) {
+      nfa.classBoundaries.push_back(u->getCharList()[i]);
+      nfa.classBoundaries.push_back(static_cast<LongInt>(u->getCharList()[i]) + 1);
+    }
+  } else if (unit->isA<Data::Grammar::UnionCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::UnionCharGroupUnit*>(unit);
+    for (Word i = 0; i < u->getCharGroupUnits()->size(); ++i) {
+      LexerDfa::collectClassBoundaries(nfa, u->getCharGroupUnits()->at(i).get());
+    }
+  } else if (unit->isA<Data::Grammar::InvertCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::InvertCharGroupUnit*>(unit);
+    LexerDfa::collectClassBoundaries(nfa, u->getChildCharGroupUnit().get());
+  }
+}
+
+
+/**
+ * Extend the given list of NFA nodes with all nodes reachable through epsilon
+ * transitions. The resulting list is sorted.
+ */
+void LexerDfa::computeClosure(Nfa const &nfa, std::vector<Int> &nodes)
+{
+  std::vector<Bool> visited(nfa.nodes.size(), false);
+  std::vector<Int> stack(nodes);
+  nodes.clear();
+  while (!stack.empty()) {
+    Int node = stack.back();
+    stack.pop_back();
+    if (visited[node]) continue;
+    visited[node] = true;
+    nodes.push_back(node);
+    for (auto epsilon : nfa.nodes[node].epsilons) {
+      if (!visited[epsilon]) stack.push_back(epsilon);
+    }
+  }
+  std::sort(nodes.begin(), nodes.end());
+}
+
+
+/**
+ * Merge equivalent states by iteratively splitting the states into blocks
+ * according to their accepted tokens and the blocks of their transitions
+ * until no more splitting is possible. The start state remains state 0.
+ */
+void LexerDfa::minimize()
+{
+  Word stateCount = this->acceptedDefIndexes.size();
+  Word classCount = this->classStarts.size();
+  std::vector<Int> blocks(stateCount);
+  Word blockCount = 0;
+
+  // Initial partitioning by accepted token.
+  {
+    std::map<Int, Int> blockIds;
+    for (Word s = 0; s < stateCount; ++s) {
+      auto iter = blockIds.find(this->acceptedDefIndexes[s]);
+      if (iter == blockIds.end()) {
+        blocks[s] = blockIds[this->acceptedDefIndexes[s]] = blockCount++;
+      } else {
+        blocks[s] = iter->second;
+      }
+    }
+  }
+
+  // Keep splitting blocks until they stabilize.
+  std::vector<Int> signature(classCount + 1);
+  while (true) {
+    std::map<std::vector<Int>, Int> blockIds;
+    std::vector<Int> newBlocks(stateCount);
+    for (Word s = 0; s < stateCount; ++s) {
+      signature[0] = blocks[s];
+      for (Word k = 0; k < classCount; ++k) {
+        Int next = this->transitions[s * classCount + k];
+        signature[k + 1] = next == -1 ? -1 : blocks[next];
+      }
+      auto iter = blockIds.find(signature);
+      if (iter == blockIds.end()) {
+        Int id = blockIds.size();
+        blockIds[signature] = id;
+        newBlocks[s] = id;
+      } else {
+        newBlocks[s] = iter->second;
+      }
+    }
+    blocks.swap(newBlocks);
+    if (blockIds.size() == blockCount) break;
+    blockCount = blockIds.size();
+  }
+  if (blockCount == stateCount) return;
+
+  // Build the minimized tables. Blocks are numbered in the order of their first state, so the start state's block
+  // is block 0.
+  std::vector<Int> transitions(blockCount * classCount, -1);
+  std::vector<Int> acceptedDefIndexes(blockCount, -1);
+  std::vector<Bool> filled(blockCount, false);
+  for (Word s = 0; s < stateCount; ++s) {
+    Int block = blocks[s];
+    if (filled[block]) continue;
+    filled[block] = true;
+    acceptedDefIndexes[block] = this->acceptedDefIndexes[s];
+    for (Word k = 0; k < classCount; ++k) {
+      Int next = this->transitions[s * classCount + k];
+      transitions[block * classCount + k] = next == -1 ? -1 : blocks[next];
+    }
+  }
+  this->transitions.swap(transitions);
+  this->acceptedDefIndexes.swap(acceptedDefIndexes);
+}
+
+} // namespace
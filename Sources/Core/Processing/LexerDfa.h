@@ -0,0 +1,223 @@
+/**
+ * @file Core/Processing/LexerDfa.h
+ * Contains the header of class Core::Processing::LexerDfa.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_LEXERDFA_H
+#define CORE_PROCESSING_LEXERDFA_H
+
+namespace Core::Processing
+{
+
+/**
+ * @brief A table driven state machine compiled from the lexer's grammar.
+ * @ingroup core_processing
+ *
+ * This class holds a minimized deterministic finite automaton generated from
+ * the root token definitions of a lexer module. Each state of the automaton
+ * corresponds to the set of lexer states that the term interpreter would have
+ * after receiving the same characters, so the lexer can replace the recursive
+ * processing of term trees with a single table lookup per character.<br>
+ * Input characters are mapped into character classes; two characters belong
+ * to the same class if no character group or const term in the grammar can
+ * tell them apart. Each accepting state records the token definition that
+ * Lexer::selectBestToken would have selected among the tokens ending at that
+ * state, and PREFER_SHORTER tokens are cut off as soon as they become the
+ * selected token.<br>
+ * Compiled objects are cached in the lexer module and are dropped when the
+ * module's caches are cleared. Grammars that can't be represented as a finite
+ * automaton (like recursive token definitions) result in an object that isn't
+ * compiled, in which case the lexer falls back to interpreting the terms.
+ */
+class LexerDfa : public TiObject
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(LexerDfa, TiObject, "Core.Processing", "Core", "alusus.org");
+
+
+  //============================================================================
+  // Data Types
+
+  /// A character matcher used by NFA transitions during compilation.
+  private: struct NfaMatcher
+  {
+    /// The char group matched by this matcher, or null for single chars.
+    Data::Grammar::CharGroupUnit *unit;
+    /// The char matched by this matcher when unit is null.
+    WChar ch;
+    /// A flag for each character class specifying whether the class matches.
+    std::vector<Bool> classes;
+  };
+
+  /**
+   * @brief A node in the NFA generated during compilation.
+   *
+   * Each node has a list of epsilon transitions and at most one character
+   * transition.
+   */
+  private: struct NfaNode
+  {
+    std::vector<Int> epsilons;
+    Int matcher = -1;
+    Int next = -1;
+    /// The index of the root token definition that generated this node.
+    Int defIndex = -1;
+  };
+
+  /// The NFA generated from the grammar's terms during compilation.
+  private: struct Nfa
+  {
+    std::vector<NfaNode> nodes;
+    std::vector<NfaMatcher> matchers;
+    std::unordered_map<Data::Grammar::CharGroupUnit*, Int> unitMatchers;
+    std::unordered_map<WChar, Int> charMatchers;
+    std::vector<LongInt> classBoundaries;
+    /// The token definitions currently being expanded, used to detect recursion.
+    std::vector<Data::Grammar::SymbolDefinition*> definitionStack;
+    Int currentDefIndex = -1;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /// Whether the grammar was successfully compiled into this object.
+  private: Bool compiled = false;
+
+  /**
+   * @brief The definitions version of the lexer module at compile time.
+   *
+   * Used to detect definitions added, replaced, or modified after compilation.
+   * @sa Data::Grammar::LexerModule::getDefinitionsVersion()
+   */
+  private: Word definitionsVersion = 0;
+
+  /// The start code of each character class, sorted ascendingly.
+  private: std::vector<LongInt> classStarts;
+
+  /// Precomputed character classes for ASCII characters.
+  private: Int asciiClasses[128];
+
+  /**
+   * @brief The transition table.
+   *
+   * Holds classStarts.size() entries per state. Each entry is the index of
+   * the next state, or -1 if the character is not accepted in that state.
+   */
+  private: std::vector<Int> transitions;
+
+  /**
+   * @brief The accepted token definition of each state.
+   *
+   * Holds the index within the lexer module of the token definition accepted
+   * when the machine reaches that state, or -1 if the state isn't an
+   * accepting state.
+   */
+  private: std::vector<Int> acceptedDefIndexes;
+
+
+  //============================================================================
+  // Constructor / Destructor
+
+  public: LexerDfa()
+  {
+  }
+
+  public: virtual ~LexerDfa()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// @name Compilation Functions
+  /// @{
+
+  /// Compile the root tokens of the context's lexer module.
+  public: static SharedPtr<LexerDfa> compile(Data::Grammar::Context *context);
+
+  private: Bool build(Data::Grammar::Context *context);
+
+  private: static Int addNfaNode(Nfa &nfa);
+
+  private: static Bool addNfaTerm(
+    Data::Grammar::Context *context, Nfa &nfa, Data::Grammar::Term *term, Int &startNode, Int &endNode
+  );
+
+  private: static Int addCharMatcher(Nfa &nfa, WChar ch);
+
+  private: static Int addCharGroupMatcher(Nfa &nfa, Data::Grammar::CharGroupUnit *unit);
+
+  private: static void collectClassBoundaries(Nfa &nfa, Data::Grammar::CharGroupUnit *unit);
+
+  private: static void computeClosure(Nfa const &nfa, std::vector<Int> &nodes);
+
+  private: void minimize();
+
+  /// @}
+
+  /// @name Data Retrieval Functions
+  /// @{
+
+  public: Bool isCompiled() const
+  {
+    return this->compiled;
+  }
+
+  public: Word getDefinitionsVersion() const
+  {
+    return this->definitionsVersion;
+  }
+
+  public: Word getStateCount() const
+  {
+    return this->acceptedDefIndexes.size();
+  }
+
+  public: Word getClassCount() const
+  {
+    return this->classStarts.size();
+  }
+
+  public: Int getStartState() const
+  {
+    return 0;
+  }
+
+  /// Get the class of the given character.
+  public: Int getCharClass(WChar ch) const
+  {
+    if (ch >= 0 && ch < 128) return this->asciiClasses[ch];
+    auto iter = std::upper_bound(this->classStarts.begin(), this->classStarts.end(), static_cast<LongInt>(ch));
+    return static_cast<Int>(iter - this->classStarts.begin()) - 1;
+  }
+
+  /// Get the state reached from the given state after receiving the given char, or -1.
+  public: Int getNextState(Int state, WChar ch) const
+  {
+    return this->transitions[state * this->classStarts.size() + this->getCharClass(ch)];
+  }
+
+  /// Get the index of the token definition accepted at the given state, or -1.
+  public: Int getAcceptedDefIndex(Int state) const
+  {
+    return this->acceptedDefIndexes[state];
+  }
+
+  /// @}
+
+}; // class
+
+} // namespace
+
+#endif
@@ -521,7 +521,8 @@ void Parser::processTokenTerm(const Data::Token * token, ParserState *state)
       throw EXCEPTION(GenericException, S("Token term's match id isn't assigned yet."));
     }
     // Match this token with the token term.
-    Bool matched = this->matchToken(matchId, matchText, token);
+    auto term = static_cast<Data::Grammar::TokenTerm*>(state->refTopTermLevel().getTerm());
+    Bool matched = this->matchToken(term, matchId, matchText, token);
     if (matched) {
       // Fire parsing handler event.
       this->getTopParsingHandler(state)->onNewToken(this, state, token);
@@ -809,11 +810,22 @@ Int Parser::determineMultiplyRoute(Data::Token const *token, ParserState *state)
   } else {
     // We can go either in or out, so we'll test.
 
+    // Keyword texts are interned when the keywords are registered. If a keyword's symbol is still null then it can't
+    // be told apart from other such keywords, so we don't cache its decision.
+    auto cacheDecision = [=](Int decision) -> Int {
+      if (!token->isKeyword()) {
+        multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = decision;
+      } else if (!token->getSymbol().isNull()) {
+        multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getSymbol()) = decision;
+      }
+      return decision;
+    };
+
     // Check if we have previously cached the decision.
     if (token->isKeyword()) {
       // For keywords we need to check against the text of the token rather than just the category to which the token
       // belongs.
-      auto i = multiplyTerm->getInnerTextBasedDecisionCache()->find(token->getText());
+      auto i = multiplyTerm->getInnerTextBasedDecisionCache()->find(token->getSymbol());
       if (i != multiplyTerm->getInnerTextBasedDecisionCache()->end()) {
         return i->second;
       }
@@ -839,12 +851,7 @@ Int Parser::determineMultiplyRoute(Data::Token const *token, ParserState *state)
     this->testState(token, &this->tempState);
     // Store results.
     if (this->tempState.getProcessingStatus() == ParserProcessingStatus::COMPLETE) {
-      if (token->isKeyword()) {
-        multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = 1;
-      } else {
-        multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = 1;
-      }
-      return 1;
+      return cacheDecision(1);
     } else {
       if (errorSync) {
         // Test outer route.
@@ -857,27 +864,12 @@ Int Parser::determineMultiplyRoute(Data::Token const *token, ParserState *state)
         // Test the temp state.
         this->testState(token, &this->tempState);
         if (this->tempState.getProcessingStatus() == ParserProcessingStatus::COMPLETE) {
-          if (token->isKeyword()) {
-            multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = 0;
-          } else {
-            multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = 0;
-          }
-          return 0;
+          return cacheDecision(0);
         } else {
-          if (token->isKeyword()) {
-            multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) =-1;
-          } else {
-            multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = -1;
-          }
-          return -1;
+          return cacheDecision(-1);
         }
       } else {
-        if (token->isKeyword()) {
-          multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = 0;
-        } else {
-          multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = 0;
-        }
-        return 0;
+        return cacheDecision(0);
       }
     }
   }
@@ -901,11 +893,22 @@ Int Parser::determineAlternateRoute(Data::Token const *token, ParserState *state
   ASSERT(state->refTopTermLevel().getTerm()->isA<Data::Grammar::AlternateTerm>());
   auto alternateTerm = static_cast<Data::Grammar::AlternateTerm*>(state->refTopTermLevel().getTerm());
 
+  // Keyword texts are interned when the keywords are registered. If a keyword's symbol is still null then it can't be
+  // told apart from other such keywords, so we don't cache its decision.
+  auto cacheDecision = [=](Int decision) -> Int {
+    if (!token->isKeyword()) {
+      alternateTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = decision;
+    } else if (!token->getSymbol().isNull()) {
+      alternateTerm->getInnerTextBasedDecisionCache()->operator[](token->getSymbol()) = decision;
+    }
+    return decision;
+  };
+
   // Check if we have previously cached the decision.
   if (token->isKeyword()) {
     // For keywords we need to check against the text of the token rather than just the category to which the token
     // beongs.
-    auto i = alternateTerm->getInnerTextBasedDecisionCache()->find(token->getText());
+    auto i = alternateTerm->getInnerTextBasedDecisionCache()->find(token->getSymbol());
     if (i != alternateTerm->getInnerTextBasedDecisionCache()->end()) {
       return i->second;
     }
@@ -936,20 +939,10 @@ Int Parser::determineAlternateRoute(Data::Token const *token, ParserState *state
     this->testState(token, &this->tempState);
     // Store results.
     if (this->tempState.getProcessingStatus()==ParserProcessingStatus::COMPLETE) {
-      if (token->isKeyword()) {
-        alternateTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = i;
-      } else {
-        alternateTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = i;
-      }
-      return i;
+      return cacheDecision(i);
     }
   }
-  if (token->isKeyword()) {
-    alternateTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = -1;
-  } else {
-    alternateTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = -1;
-  }
-  return -1;
+  return cacheDecision(-1);
 }
 
 
@@ -1082,7 +1075,8 @@ void Parser::testTokenTerm(Data::Token const *token, ParserState *state)
     if (matchId == UNKNOWN_ID && matchText == 0) {
       throw EXCEPTION(GenericException, S("Token term's match id isn't assigned yet."));
     }
-    Bool matched = this->matchToken(matchId, matchText, token);
+    auto term = static_cast<Data::Grammar::TokenTerm*>(state->refTopTermLevel().getTerm());
+    Bool matched = this->matchToken(term, matchId, matchText, token);
     if (matched) {
       // Processing of this state is complete.
       state->ownTopLevel();
@@ -1540,8 +1534,17 @@ Bool Parser::isDefinitionInUse(Data::Grammar::SymbolDefinition *definition) cons
 }
 
 
-Bool Parser::matchToken(Word matchId, TiObject *matchText, Data::Token const *token)
-{
+/**
+ * Match the given token against the id and text of a token term. If the text
+ * is the term's own string the comparison is done on the interned symbols,
+ * which avoids comparing the strings of the token and the term for every
+ * token term the token is tested against. The token's text is only looked up
+ * in the symbol table, not interned, so texts that don't appear in the
+ * grammar don't grow the table.
+ */
+Bool Parser::matchToken(
+  Data::Grammar::TokenTerm *term, Word matchId, TiObject *matchText, Data::Token const *token
+) {
   Bool matched = true;
   TiStr *matchStr = 0;
   if (matchId != 0 && matchId != token->getId()) {
@@ -1549,8 +1552,14 @@ Bool Parser::matchToken(Word matchId, TiObject *matchText, Data::Token const *to
   }
   if (matched == true && matchText != 0) {
     if (matchText->isA<TiStr>()) {
-      matchStr = static_cast<TiStr*>(matchText);
-      if (matchStr->getStr() != token->getText()) matched = false;
+      Symbol matchSymbol;
+      if (term != 0 && term->getTokenText().get() == matchText) matchSymbol = term->getTokenSymbol();
+      if (!matchSymbol.isNull()) {
+        if (matchSymbol != token->getSymbol()) matched = false;
+      } else {
+        matchStr = static_cast<TiStr*>(matchText);
+        if (matchStr->getStr() != token->getText()) matched = false;
+      }
     } else if (matchText->isA<Data::Grammar::Map>()) {
       if (static_cast<Data::Grammar::Map*>(matchText)->findIndex(token->getText()) == -1) matched = false;
     }
@@ -1574,7 +1583,7 @@ Bool Parser::matchErrorSyncBlockPairs(ParserState *state, Data::Token const *tok
     Data::Grammar::TokenTerm *term = static_cast<Data::Grammar::TokenTerm*>(element);
     TiInt *matchId = term->getTokenId().ti_cast_get<TiInt>();
     TiObject *matchText = term->getTokenText().get();
-    if (this->matchToken(matchId, matchText, token)) {
+    if (this->matchToken(term, matchId, matchText, token)) {
       state->getErrorSyncBlockStack().push_back(i);
       return true;
     }
@@ -1598,7 +1607,7 @@ Bool Parser::matchErrorSyncBlockPairs(ParserState *state, Data::Token const *tok
   Data::Grammar::TokenTerm *term = static_cast<Data::Grammar::TokenTerm*>(element);
   TiInt *matchId = term->getTokenId().ti_cast_get<TiInt>();
   TiObject *matchText = term->getTokenText().get();
-  if (this->matchToken(matchId, matchText, token)) {
+  if (this->matchToken(term, matchId, matchText, token)) {
     state->getErrorSyncBlockStack().pop_back();
   }
   return true;
@@ -133,6 +133,12 @@ class Parser : public TiObject
     return this->grammarRoot;
   }
 
+  /// Get the state of the parsing operation currently in progress, if any.
+  public: ParserState* getState() const
+  {
+    return this->state.get();
+  }
+
   public: void setCompleteLevelsPreClosing(Bool v)
   {
     this->preCloseCompleteLevels = v;
@@ -247,12 +253,15 @@ class Parser : public TiObject
   /// Check whether the production with the given id is currently in use.
   public: Bool isDefinitionInUse(Data::Grammar::SymbolDefinition *definition) const;
 
-  private: Bool matchToken(TiInt *matchId, TiObject *matchText, Data::Token const *token)
-  {
-    return this->matchToken(matchId==0?0:matchId->get(), matchText, token);
+  private: Bool matchToken(
+    Data::Grammar::TokenTerm *term, TiInt *matchId, TiObject *matchText, Data::Token const *token
+  ) {
+    return this->matchToken(term, matchId==0?0:matchId->get(), matchText, token);
   }
 
-  private: Bool matchToken(Word matchId, TiObject *matchText, Data::Token const *token);
+  private: Bool matchToken(
+    Data::Grammar::TokenTerm *term, Word matchId, TiObject *matchText, Data::Token const *token
+  );
 
   private: Bool matchErrorSyncBlockPairs(ParserState *state, Data::Token const *token);
 
@@ -27,4 +27,21 @@ void computeNextCharPosition(WChar ch, Int &line, Int &column)
   }
 }
 
+
+Word getAsciiRunLength(Char const *chars, Word count)
+{
+  Word i = 0;
+  // Check a whole word at a time for bytes with the high bit set.
+  constexpr Word wordSize = sizeof(LongWord);
+  constexpr LongWord highBits = ~static_cast<LongWord>(0) / 0xFF * 0x80;
+  while (i + wordSize <= count) {
+    LongWord word;
+    memcpy(&word, chars + i, wordSize);
+    if ((word & highBits) != 0) break;
+    i += wordSize;
+  }
+  while (i < count && (static_cast<Byte>(chars[i]) & 0x80) == 0) ++i;
+  return i;
+}
+
 } } // namespace
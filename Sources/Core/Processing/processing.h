@@ -83,6 +83,33 @@ namespace Core::Processing
  */
 #define LEXER_ERROR_BUFFER_MAX_CHARACTERS 80
 
+/**
+ * @brief The maximum number of NFA nodes generated while compiling the lexer DFA.
+ * @ingroup core_processing
+ *
+ * If the grammar's tokens need more nodes than this number, the compilation
+ * fails and the lexer falls back to interpreting the grammar terms.
+ */
+#define LEXER_DFA_MAX_NFA_NODES 100000
+
+/**
+ * @brief The maximum number of states in a compiled lexer DFA.
+ * @ingroup core_processing
+ *
+ * If the grammar's tokens need more states than this number, the compilation
+ * fails and the lexer falls back to interpreting the grammar terms.
+ */
+#define LEXER_DFA_MAX_STATES 20000
+
+/**
+ * @brief The size of the blocks used when reading source files.
+ * @ingroup core_processing
+ *
+ * Source files that can't be memory mapped are read and passed to the lexer
+ * in blocks of this size.
+ */
+#define FILE_READ_BLOCK_SIZE 65536
+
 /**
  * @brief Compute the next position based on the given character.
  * @ingroup core_processing
@@ -102,6 +129,21 @@ namespace Core::Processing
  */
 void computeNextCharPosition(WChar ch, Int &line, Int &column);
 
+/**
+ * @brief Get the length of the run of ASCII characters at the given buffer.
+ * @ingroup core_processing
+ *
+ * Counts the bytes at the beginning of the given buffer that are below 0x80,
+ * which can be passed to the lexer without UTF-8 decoding. The buffer is
+ * scanned one machine word at a time.
+ *
+ * @param chars The buffer to scan.
+ * @param count The number of bytes in the buffer.
+ * @return The number of ASCII bytes before the first non ASCII byte, or count
+ *         if all the bytes are ASCII.
+ */
+Word getAsciiRunLength(Char const *chars, Word count);
+
 
 //==============================================================================
 // Parser Definitions
@@ -230,6 +272,7 @@ s_enum(ParsingFlags,
 // Lexer
 #include "InputBuffer.h"
 #include "LexerState.h"
+#include "LexerDfa.h"
 #include "TokenizingHandler.h"
 #include "Lexer.h"
 
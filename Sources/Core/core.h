@@ -17,6 +17,7 @@
 #include <vector>
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <string>
 #include <iostream>
@@ -25,6 +26,8 @@
 #include <type_traits>
 #include <atomic>
 #include <functional>
+#include <mutex>
+#include <thread>
 #include <limits.h>
 
 // Other Alusus headers
@@ -52,6 +52,8 @@ int main(int argCount, char * const args[])
   Bool interactive = false;
   Char const *sourceFile = 0;
   Bool dump = false;
+  Bool parseCache = false;
+  Bool verifyParseCache = false;
   if (argCount < 2) help = true;
   for (Int i = 1; i < argCount; ++i) {
     if (strcmp(args[i], S("--help")) == 0) help = true;
@@ -62,6 +64,19 @@ int main(int argCount, char * const args[])
     else if (strcmp(args[i], S("-ت")) == 0) interactive = true;
     else if (strcmp(args[i], S("--dump")) == 0) dump = true;
     else if (strcmp(args[i], S("--إلقاء")) == 0) dump = true;
+    else if (strcmp(args[i], S("--parse-cache")) == 0) parseCache = true;
+    else if (strcmp(args[i], S("--تخبئة")) == 0) parseCache = true;
+    else if (strcmp(args[i], S("--verify-parse-cache")) == 0) verifyParseCache = true;
+    else if (strcmp(args[i], S("--تحقق_التخبئة")) == 0) verifyParseCache = true;
+    // The JIT compile thread count is passed to the JIT targets through the environment.
+    else if (strcmp(args[i], S("--jit-threads")) == 0 || strcmp(args[i], S("--خيوط_الترجمة")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        setenv(S("ALUSUS_JIT_THREADS"), args[i], 1);
+      } else {
+        help = true;
+      }
+    }
 #ifdef USE_LOGS
     // Parse the log option.
     else if (strcmp(args[i], S("--log")) == 0 || strcmp(args[i], S("--تدوين")) == 0) {
@@ -118,6 +133,15 @@ int main(int argCount, char * const args[])
       outStream << S("\tالقاء شجرة AST عند الانتهاء:\n");
       outStream << S("\t\t--شجرة\n");
       outStream << S("\t\t--dump\n");
+      outStream << S("\tتفعيل تخبئة نتائج الإعراب:\n");
+      outStream << S("\t\t--تخبئة\n");
+      outStream << S("\t\t--parse-cache\n");
+      outStream << S("\tالتحقق من نتائج الإعراب المخبأة بإعادة إعراب الملفات:\n");
+      outStream << S("\t\t--تحقق_التخبئة\n");
+      outStream << S("\t\t--verify-parse-cache\n");
+      outStream << S("\tعدد خيوط ترجمة الشفرة أثناء التنفيذ (0 للترجمة على خيط التنفيذ، وهو الافتراضي):\n");
+      outStream << S("\t\t--خيوط_الترجمة <العدد>\n");
+      outStream << S("\t\t--jit-threads <count>\n");
       #if defined(USE_LOGS)
         outStream << S("\tالتحكم بمستوى التدوين (قيمة من 6 بتات):\n");
         outStream << S("\t\t--تدوين\n");
@@ -138,6 +162,9 @@ int main(int argCount, char * const args[])
       outStream << S("\nOptions:\n");
       outStream << S("\t--interactive, -i  Run in interactive mode.\n");
       outStream << S("\t--dump  Tells the Core to dump the resulting AST tree.\n");
+      outStream << S("\t--parse-cache  Use and update the on-disk cache of parse results.\n");
+      outStream << S("\t--verify-parse-cache  Reparse cached files and verify the cached results.\n");
+      outStream << S("\t--jit-threads <count>  JIT compile threads; 0, the default, compiles on the main thread.\n");
       #if defined(USE_LOGS)
         outStream << S("\t--log  A 6 bit value to control the level of details of the log.\n");
       #endif
@@ -159,6 +186,8 @@ int main(int argCount, char * const args[])
       root.setInteractive(true);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang);
+      if (parseCache || verifyParseCache) root.getParseCache()->setEnabled(true);
+      root.getParseCache()->setVerifying(verifyParseCache);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
         [](SharedPtr<Notices::Notice> const &notice)->void
         {
@@ -184,6 +213,8 @@ int main(int argCount, char * const args[])
       Main::RootManager root;
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang);
+      if (parseCache || verifyParseCache) root.getParseCache()->setEnabled(true);
+      root.getParseCache()->setVerifying(verifyParseCache);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
         [](SharedPtr<Notices::Notice> const &notice)->void
         {
@@ -620,9 +620,9 @@ void CalleeTracer::_lookupCallee_builtInOp(TiObject *self, CalleeLookupRequest &
     result.notice = newSrdObj<Spp::Notices::InvalidOperationNotice>();
     return;
   } else if (request.op == S("()")) {
-    // Type must be an array for () operator.
-    if (type->isDerivedFrom<ArrayType>()) {
-      // We have an array.
+    // Type must be an array or a vector for () operator.
+    if (type->isDerivedFrom<ArrayType>() || type->isDerivedFrom<VectorType>()) {
+      // We have an array or a vector.
       if (
         request.argTypes != 0 && request.argTypes->getElementCount() == 1 &&
         helper->isImplicitlyCastableTo(request.argTypes->getElement(0), helper->getArchIntType(), request.ec)
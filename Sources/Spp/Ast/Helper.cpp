@@ -37,6 +37,7 @@ void Helper::initBindingCaches()
     &this->getBoolType,
     &this->getCharType,
     &this->getCharArrayType,
+    &this->getIntVectorType,
     &this->getArchIntType,
     &this->getIntType,
     &this->getWord64Type,
@@ -73,6 +74,7 @@ void Helper::initBindings()
   this->getBoolType = &Helper::_getBoolType;
   this->getCharType = &Helper::_getCharType;
   this->getCharArrayType = &Helper::_getCharArrayType;
+  this->getIntVectorType = &Helper::_getIntVectorType;
   this->getArchIntType = &Helper::_getArchIntType;
   this->getIntType = &Helper::_getIntType;
   this->getWord64Type = &Helper::_getWord64Type;
@@ -512,32 +514,30 @@ IntegerType* Helper::_getCharType(TiObject *self)
 ArrayType* Helper::_getCharArrayType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+  auto iter = helper->charArrayTypes.find(size);
+  if (iter != helper->charArrayTypes.end()) return iter->second;
 
-  // Prepare the reference.
-  if (helper->charArrayTypeRef == 0) {
-    // Create a new reference.
-    StrStream stream;
-    stream << S("array[Word[8],") << size << S("]");
-    helper->charArrayTypeRef = helper->rootManager->parseExpression(stream.str().c_str())
-      .s_cast<Core::Data::Ast::ParamPass>();
-    helper->charArrayTypeRef->setOwner(helper->rootManager->getRootScope().get());
-  } else {
-    // Recycle the existing reference.
-    auto intLiteral = helper->charArrayTypeRef
-      ->getParam().ti_cast_get<Core::Data::Ast::List>()
-      ->get(1).ti_cast_get<Core::Data::Ast::IntegerLiteral>();
-    if (!intLiteral) {
-      throw EXCEPTION(GenericException, S("Unexpected internal error."));
-    }
-    intLiteral->setValue(std::to_string(size).c_str());
-  }
-  // Seek the requested type.
-  auto astType = ti_cast<Ast::ArrayType>(
-    helper->getSeeker()->doGet(helper->charArrayTypeRef.get(), helper->rootManager->getRootScope().get())
-  );
+  auto astType = ti_cast<Ast::ArrayType>(helper->lookupSizedType(S("array"), size, S("Word"), 8));
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get char array AST type."));
   }
+  helper->charArrayTypes[size] = astType;
+  return astType;
+}
+
+
+VectorType* Helper::_getIntVectorType(TiObject *self, Word bitCount, Word size)
+{
+  PREPARE_SELF(helper, Helper);
+  LongWord key = (static_cast<LongWord>(bitCount) << 32) | size;
+  auto iter = helper->intVectorTypes.find(key);
+  if (iter != helper->intVectorTypes.end()) return iter->second;
+
+  auto astType = ti_cast<Ast::VectorType>(helper->lookupSizedType(S("vector"), size, S("Int"), bitCount));
+  if (astType == 0) {
+    throw EXCEPTION(GenericException, S("Failed to get int vector AST type."));
+  }
+  helper->intVectorTypes[key] = astType;
   return astType;
 }
 
@@ -555,29 +555,14 @@ IntegerType* Helper::_getArchIntType(TiObject *self)
 IntegerType* Helper::_getIntType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
-  // Prepare the reference.
-  if (helper->integerTypeRef == 0) {
-    // Create a new reference.
-    StrStream stream;
-    stream << S("Int[") << size << S("]");
-    helper->integerTypeRef = helper->rootManager->parseExpression(stream.str().c_str())
-      .s_cast<Core::Data::Ast::ParamPass>();
-    helper->integerTypeRef->setOwner(helper->rootManager->getRootScope().get());
-  } else {
-    // Recycle the existing reference.
-    auto intLiteral = helper->integerTypeRef->getParam().ti_cast_get<Core::Data::Ast::IntegerLiteral>();
-    if (!intLiteral) {
-      throw EXCEPTION(GenericException, S("Unexpected internal error."));
-    }
-    intLiteral->setValue(std::to_string(size).c_str());
-  }
-  // Generate the llvm type.
-  auto astType = ti_cast<Ast::IntegerType>(
-    helper->getSeeker()->doGet(helper->integerTypeRef.get(), helper->rootManager->getRootScope().get())
-  );
+  auto iter = helper->intTypes.find(size);
+  if (iter != helper->intTypes.end()) return iter->second;
+
+  auto astType = ti_cast<Ast::IntegerType>(helper->lookupSizedType(S("Int"), size));
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get integer AST type."));
   }
+  helper->intTypes[size] = astType;
   return astType;
 }
 
@@ -595,29 +580,14 @@ IntegerType* Helper::_getWord64Type(TiObject *self)
 IntegerType* Helper::_getWordType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
-  // Prepare the reference.
-  if (helper->wordTypeRef == 0) {
-    // Create a new reference.
-    StrStream stream;
-    stream << S("Word[") << size << S("]");
-    helper->wordTypeRef = helper->rootManager->parseExpression(stream.str().c_str())
-      .s_cast<Core::Data::Ast::ParamPass>();
-    helper->wordTypeRef->setOwner(helper->rootManager->getRootScope().get());
-  } else {
-    // Recycle the existing reference.
-    auto intLiteral = helper->wordTypeRef->getParam().ti_cast_get<Core::Data::Ast::IntegerLiteral>();
-    if (!intLiteral) {
-      throw EXCEPTION(GenericException, S("Unexpected internal error."));
-    }
-    intLiteral->setValue(std::to_string(size).c_str());
-  }
-  // Generate the llvm type.
-  auto astType = ti_cast<Ast::IntegerType>(
-    helper->getSeeker()->doGet(helper->wordTypeRef.get(), helper->rootManager->getRootScope().get())
-  );
+  auto iter = helper->wordTypes.find(size);
+  if (iter != helper->wordTypes.end()) return iter->second;
+
+  auto astType = ti_cast<Ast::IntegerType>(helper->lookupSizedType(S("Word"), size));
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get integer AST type."));
   }
+  helper->wordTypes[size] = astType;
   return astType;
 }
 
@@ -625,33 +595,103 @@ IntegerType* Helper::_getWordType(TiObject *self, Word size)
 FloatType* Helper::_getFloatType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
-  // Prepare the reference.
-  if (helper->floatTypeRef == 0) {
-    // Create a new reference.
-    StrStream stream;
-    stream << S("Float[") << size << S("]");
-    helper->floatTypeRef = helper->rootManager->parseExpression(stream.str().c_str())
-      .s_cast<Core::Data::Ast::ParamPass>();
-    helper->floatTypeRef->setOwner(helper->rootManager->getRootScope().get());
-  } else {
-    // Recycle the existing reference.
-    auto intLiteral = helper->floatTypeRef->getParam().ti_cast_get<Core::Data::Ast::IntegerLiteral>();
-    if (!intLiteral) {
-      throw EXCEPTION(GenericException, S("Unexpected internal error."));
-    }
-    intLiteral->setValue(std::to_string(size).c_str());
-  }
-  // Generate the llvm type.
-  auto astType = ti_cast<Ast::FloatType>(
-    helper->getSeeker()->doGet(helper->floatTypeRef.get(), helper->rootManager->getRootScope().get())
-  );
+  auto iter = helper->floatTypes.find(size);
+  if (iter != helper->floatTypes.end()) return iter->second;
+
+  auto astType = ti_cast<Ast::FloatType>(helper->lookupSizedType(S("Float"), size));
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get float AST type."));
   }
+  helper->floatTypes[size] = astType;
   return astType;
 }
 
 
+TiObject* Helper::lookupSizedType(
+  Char const *typeName, Word size, Char const *elementTypeName, Word elementSize
+) {
+  // A new reference is created for each lookup rather than recycling a shared reference node, so lookups don't
+  // modify any shared state.
+  auto makeRef = [](Char const *name, TioSharedPtr const &param)->SharedPtr<Core::Data::Ast::ParamPass> {
+    return Core::Data::Ast::ParamPass::create({
+      {S("type"), Core::Data::Ast::BracketType(Core::Data::Ast::BracketType::SQUARE)}
+    }, {
+      {S("operand"), Core::Data::Ast::Identifier::create({ {S("value"), TiStr(name)} })},
+      {S("param"), param}
+    });
+  };
+  auto sizeRef = Core::Data::Ast::IntegerLiteral::create({ {S("value"), TiStr(std::to_string(size).c_str())} });
+  SharedPtr<Core::Data::Ast::ParamPass> typeRef;
+  if (elementTypeName == 0) {
+    typeRef = makeRef(typeName, sizeRef);
+  } else {
+    auto elementRef = makeRef(elementTypeName, Core::Data::Ast::IntegerLiteral::create({
+      {S("value"), TiStr(std::to_string(elementSize).c_str())}
+    }));
+    typeRef = makeRef(typeName, Core::Data::Ast::List::create({}, { elementRef, sizeRef }));
+  }
+  auto root = this->rootManager->getRootScope().get();
+  typeRef->setOwner(root);
+  auto result = this->getSeeker()->doGet(typeRef.get(), root);
+  this->watchRootScope();
+  return result;
+}
+
+
+void Helper::watchRootScope()
+{
+  this->rootManager->getRootScope()->changeNotifier.connect(this->rootScopeChangeSlot);
+}
+
+
+void Helper::onRootScopeChanged(SharedListBase<TiObject, Core::Data::Node> *list, ContentChangeOp op, Int index)
+{
+  // The element is already gone by the time REMOVED is emitted, but WILL_REMOVE has been handled before it.
+  if (op == ContentChangeOp::REMOVED) return;
+
+  // Sized types are only looked up by the names of root definitions, so other definitions can't affect them. Other
+  // elements, like statements, don't affect lookups either, except for bridges which can bring in any name.
+  auto element = list->get(index).get();
+  auto def = ti_cast<Core::Data::Ast::Definition>(element);
+  if (def == 0) {
+    if (ti_cast<Core::Data::Ast::Bridge>(element) != 0) this->clearTypeCaches();
+    return;
+  }
+  auto const &name = def->getName();
+  if (name == S("Int")) {
+    this->intTypes.clear();
+    this->intVectorTypes.clear();
+    this->archIntType = 0;
+  } else if (name == S("Word")) {
+    this->wordTypes.clear();
+    this->charArrayTypes.clear();
+    this->boolType = 0;
+    this->charType = 0;
+    this->word64Type = 0;
+  } else if (name == S("Float")) {
+    this->floatTypes.clear();
+  } else if (name == S("array")) {
+    this->charArrayTypes.clear();
+  } else if (name == S("vector")) {
+    this->intVectorTypes.clear();
+  }
+}
+
+
+void Helper::clearTypeCaches()
+{
+  this->intTypes.clear();
+  this->wordTypes.clear();
+  this->floatTypes.clear();
+  this->charArrayTypes.clear();
+  this->intVectorTypes.clear();
+  this->boolType = 0;
+  this->charType = 0;
+  this->archIntType = 0;
+  this->word64Type = 0;
+}
+
+
 VoidType* Helper::_getVoidType(TiObject *self)
 {
   PREPARE_SELF(helper, Helper);
@@ -47,10 +47,29 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   private: IntegerType *word64Type = 0;
   private: VoidType *voidType = 0;
   private: UserType *tiObjectType = 0;
-  private: SharedPtr<Core::Data::Ast::ParamPass> integerTypeRef;
-  private: SharedPtr<Core::Data::Ast::ParamPass> wordTypeRef;
-  private: SharedPtr<Core::Data::Ast::ParamPass> floatTypeRef;
-  private: SharedPtr<Core::Data::Ast::ParamPass> charArrayTypeRef;
+
+  /**
+   * @brief Caches of sized types, keyed by bit count or array size.
+   *
+   * These caches, along with the bool, char, arch int, and word64 types, are
+   * cleared when a root definition they were looked up by changes, or when a
+   * bridge is added to or removed from the root scope. They aren't synchronized, so
+   * like the rest of the helper and the seeker it relies on they must only be
+   * used from the thread running the compilation.
+   */
+  private: std::unordered_map<Word, IntegerType*> intTypes;
+  private: std::unordered_map<Word, IntegerType*> wordTypes;
+  private: std::unordered_map<Word, FloatType*> floatTypes;
+  private: std::unordered_map<Word, ArrayType*> charArrayTypes;
+  private: std::unordered_map<LongWord, VectorType*> intVectorTypes;
+
+
+  //============================================================================
+  // Signals & Slots
+
+  private: Slot<void, SharedListBase<TiObject, Core::Data::Node>*, ContentChangeOp, Int> rootScopeChangeSlot = {
+    this, &Helper::onRootScopeChanged
+  };
 
 
   //============================================================================
@@ -95,6 +114,8 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
     this->refTemplate = 0;
   }
 
+  private: void onRootScopeChanged(SharedListBase<TiObject, Core::Data::Node> *list, ContentChangeOp op, Int index);
+
   /// @}
 
   /// @name Property Getters
@@ -198,6 +219,10 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: METHOD_BINDING_CACHE(getCharArrayType, ArrayType*, (Word));
   private: static ArrayType* _getCharArrayType(TiObject *self, Word size);
 
+  /// Get the type of vector[Int[bitCount], size], which is the type of vector comparison results.
+  public: METHOD_BINDING_CACHE(getIntVectorType, VectorType*, (Word, Word));
+  private: static VectorType* _getIntVectorType(TiObject *self, Word bitCount, Word size);
+
   public: METHOD_BINDING_CACHE(getArchIntType, IntegerType*);
   private: static IntegerType* _getArchIntType(TiObject *self);
 
@@ -213,6 +238,22 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: METHOD_BINDING_CACHE(getFloatType, FloatType*, (Word));
   private: static FloatType* _getFloatType(TiObject *self, Word size);
 
+  /**
+   * @brief Look up a sized type from the root scope.
+   *
+   * Looks up a type with a single size parameter, like `Int[32]`, or, if an
+   * element type name is given, a type with a sized element type followed
+   * by a size, like `array[Word[8], 16]`.
+   */
+  private: TiObject* lookupSizedType(
+    Char const *typeName, Word size, Char const *elementTypeName = 0, Word elementSize = 0
+  );
+
+  /// Make sure the type caches get invalidated when the root scope changes.
+  private: void watchRootScope();
+
+  private: void clearTypeCaches();
+
   public: METHOD_BINDING_CACHE(getVoidType, VoidType*);
   private: static VoidType* _getVoidType(TiObject *self);
 
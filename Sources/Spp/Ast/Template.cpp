@@ -55,17 +55,16 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
   }
 
   // Do we already have an instance?
-  auto count = this->instances.getCount();
-  for (Int i = 0; i < count; ++i) {
-    if (this->matchTemplateVars(&vars, this->instances.getElement(i), helper, notice)) {
-      result = this->instances.get(i)->get(0);
+  auto key = this->generateInstanceKey(&vars);
+  auto iter = this->instancesIndex.find(key);
+  if (iter != this->instancesIndex.end()) {
+    auto instance = this->instances.get(iter->second).get();
+    if (this->isInstanceOf(instance, &vars)) {
+      result = instance->get(0);
       return true;
-    } else {
-      if (notice != 0) {
-        result = notice;
-        return false;
-      }
     }
+    // The instance no longer matches its key, so replace its entry with a new instance.
+    this->instancesIndex.erase(iter);
   }
 
   // No instance was found, create a new one.
@@ -78,6 +77,7 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
   }
   this->instances.add(block);
   block->setOwner(this);
+  this->instancesIndex[key] = this->instances.getCount() - 1;
   result = this->instances.get(this->instances.getCount() - 1)->get(0);
   return true;
 }
@@ -156,57 +156,53 @@ Bool Template::prepareTemplateVars(
 }
 
 
-Bool Template::matchTemplateVars(
-  Containing<TiObject> *templateInputs, Core::Data::Ast::Scope *instance, Helper *helper,
-  SharedPtr<Core::Notices::Notice> &notice
-) {
+std::string Template::generateInstanceKey(Containing<TiObject> *templateVars)
+{
+  std::string key;
   for (Int i = 0; i < this->getVarDefCount(); ++i) {
     auto varDef = this->varDefs->get(i).s_cast_get<TemplateVarDef>();
     ASSERT(varDef != 0);
-    if (!this->matchTemplateVar(templateInputs->getElement(i), instance, varDef, helper, notice)) return false;
-  }
-  return true;
-}
-
-
-Bool Template::matchTemplateVar(
-  TiObject *templateInput, Core::Data::Ast::Scope *instance, TemplateVarDef *varDef, Helper *helper,
-  SharedPtr<Core::Notices::Notice> &notice
-) {
-  switch (varDef->getType().get()) {
-    case TemplateVarType::INTEGER: {
-      auto var = ti_cast<Core::Data::Ast::IntegerLiteral>(
-        Template::getTemplateVar(instance, varDef->getName().get())
-      );
-      if (var == 0) {
-        throw EXCEPTION(GenericException, S("Missing variable in template instance."));
+    auto var = templateVars->getElement(i);
+    switch (varDef->getType().get()) {
+      case TemplateVarType::INTEGER: {
+        auto intVar = static_cast<Core::Data::Ast::IntegerLiteral*>(var);
+        key += 'i';
+        key += std::to_string(std::stol(intVar->getValue().get()));
+        break;
       }
-      auto newVar = static_cast<Core::Data::Ast::IntegerLiteral*>(templateInput);
-      ASSERT(newVar != 0);
-      return std::stol(newVar->getValue().get()) == std::stol(var->getValue().get());
-    }
 
-    case TemplateVarType::STRING: {
-      auto var = ti_cast<Core::Data::Ast::StringLiteral>(
-        Template::getTemplateVar(instance, varDef->getName().get())
-      );
-      if (var == 0) {
-        throw EXCEPTION(GenericException, S("Missing variable in template instance."));
+      case TemplateVarType::STRING: {
+        // Prefix the value with its length to keep the key unambiguous.
+        auto strVar = static_cast<Core::Data::Ast::StringLiteral*>(var);
+        std::string value = strVar->getValue().get();
+        key += 's';
+        key += std::to_string(value.size());
+        key += ':';
+        key += value;
+        break;
       }
-      auto newVar = static_cast<Core::Data::Ast::StringLiteral*>(templateInput);
-      ASSERT(newVar != 0);
-      return newVar->getValue() == var->getValue();
-    }
 
-    default: {
-      auto var = Template::getTemplateVar(instance, varDef->getName().get());
-      if (var == 0) {
-        throw EXCEPTION(GenericException, S("Missing variable in template instance."));
+      default: {
+        key += 'p';
+        key += std::to_string(reinterpret_cast<LongWord>(var));
+        break;
       }
-      ASSERT(templateInput != 0);
-      return templateInput == var;
     }
+    key += ';';
   }
+  return key;
+}
+
+
+Bool Template::isInstanceOf(Core::Data::Ast::Scope const *instance, Containing<TiObject> *templateVars)
+{
+  for (Int i = 0; i < this->getVarDefCount(); ++i) {
+    auto varDef = this->varDefs->get(i).s_cast_get<TemplateVarDef>();
+    ASSERT(varDef != 0);
+    if (varDef->getType() == TemplateVarType::INTEGER || varDef->getType() == TemplateVarType::STRING) continue;
+    if (Template::getTemplateVar(instance, varDef->getName().get()) != templateVars->getElement(i)) return false;
+  }
+  return true;
 }
 
 
@@ -233,13 +229,12 @@ Bool Template::assignTemplateVars(
 
 TiObject* Template::getTemplateVar(Core::Data::Ast::Scope const *instance, Char const *name)
 {
-  for (Int i = 0; i < instance->getCount(); ++i) {
-    auto def = ti_cast<Core::Data::Ast::Definition>(instance->getElement(i));
-    if (def != 0 && def->getName() == name) {
-      auto box = def->getTarget().ti_cast_get<TioWeakBox>();
-      if (box != 0) return box->get().get();
-      else return def->getTarget().get();
-    }
+  Int index = instance->findDefinitionIndex(Str(name));
+  if (index != -1) {
+    auto def = static_cast<Core::Data::Ast::Definition*>(instance->getElement(index));
+    auto box = def->getTarget().ti_cast_get<TioWeakBox>();
+    if (box != 0) return box->get().get();
+    else return def->getTarget().get();
   }
   throw EXCEPTION(GenericException, S("Template var not found."));
 }
@@ -39,6 +39,16 @@ class Template : public Core::Data::Node,
 
   private: SharedList<Core::Data::Ast::Scope> instances;
 
+  /**
+   * @brief An index of the instances keyed by their template vars.
+   *
+   * Maps the key generated by generateInstanceKey for the vars of each
+   * instance to the index of that instance in the instances list. Like the
+   * instances themselves, the index doesn't own the type and function vars,
+   * and entries never outlive the instances they point to.
+   */
+  private: std::unordered_map<std::string, Int> instancesIndex;
+
 
   //============================================================================
   // Implementations
@@ -115,14 +125,18 @@ class Template : public Core::Data::Node,
     TiObject *templateInputs, Helper *helper, PlainList<TiObject> *vars, SharedPtr<Core::Notices::Notice> &notice
   );
 
-  private: Bool matchTemplateVars(
-    Containing<TiObject> *templateInputs, Core::Data::Ast::Scope *instance, Helper *helper,
-    SharedPtr<Core::Notices::Notice> &notice
-  );
-  private: Bool matchTemplateVar(
-    TiObject *templateInput, Core::Data::Ast::Scope *instance, TemplateVarDef *varDef, Helper *helper,
-    SharedPtr<Core::Notices::Notice> &notice
-  );
+  /**
+   * @brief Generate a key that uniquely identifies the given template vars.
+   *
+   * Integer and string vars are identified by their values, while type and
+   * function vars are identified by the identity of the traced object, so
+   * two lists of vars get the same key exactly when they instantiate the
+   * same instance.
+   */
+  private: std::string generateInstanceKey(Containing<TiObject> *templateVars);
+
+  /// Check whether the vars assigned to the given instance are the given template vars.
+  private: Bool isInstanceOf(Core::Data::Ast::Scope const *instance, Containing<TiObject> *templateVars);
 
   private: Bool assignTemplateVars(
     Containing<TiObject> *templateInputs, Core::Data::Ast::Scope *instance, Helper *helper,
@@ -0,0 +1,63 @@
+/**
+ * @file Spp/Ast/VectorType.h
+ * Contains the header of class Spp::Ast::VectorType.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_VECTORTYPE_H
+#define SPP_AST_VECTORTYPE_H
+
+namespace Spp::Ast
+{
+
+/**
+ * @brief A SIMD vector of integers or floats.
+ *
+ * Vectors are lowered directly into LLVM vector types. Arithmetic, binary,
+ * and comparison operations are applied element-wise, and elements are
+ * accessed the same way array elements are accessed.
+ */
+class VectorType : public DataType
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(VectorType, DataType, "Spp.Ast", "Spp", "alusus.org");
+  OBJECT_FACTORY(VectorType);
+
+  IMPLEMENT_AST_MAP_PRINTABLE(VectorType);
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(VectorType);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(VectorType);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(VectorType);
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Get the element type, or 0 if it's not an integer or a float type.
+  public: Type* getContentType(Helper *helper) const;
+
+  public: Word getSize(Helper *helper) const;
+
+  public: virtual TypeMatchStatus matchTargetType(
+    Type const *type, Helper *helper, ExecutionContext const *ec, TypeMatchOptions opts = TypeMatchOptions::NONE
+  ) const;
+
+}; // class
+
+} // namespace
+
+#endif
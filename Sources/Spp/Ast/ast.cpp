@@ -14,7 +14,7 @@
 namespace Spp::Ast
 {
 
-Char const* findOperationModifier(Core::Data::Ast::Definition const *def)
+static Char const* findStringModifier(Core::Data::Ast::Definition const *def, Char const *name)
 {
   auto modifiers = def->getModifiers().get();
   if (modifiers != 0) {
@@ -22,7 +22,7 @@ Char const* findOperationModifier(Core::Data::Ast::Definition const *def)
       auto paramPass = ti_cast<Core::Data::Ast::ParamPass>(modifiers->getElement(i));
       if (paramPass != 0) {
         auto identifier = paramPass->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
-        if (identifier != 0 && identifier->getValue() == S("operation")) {
+        if (identifier != 0 && identifier->getValue() == name) {
           auto stringLiteral = paramPass->getParam().ti_cast_get<Core::Data::Ast::StringLiteral>();
           if (stringLiteral != 0) return stringLiteral->getValue().get();
         }
@@ -32,4 +32,16 @@ Char const* findOperationModifier(Core::Data::Ast::Definition const *def)
   return 0;
 }
 
+
+Char const* findOperationModifier(Core::Data::Ast::Definition const *def)
+{
+  return findStringModifier(def, S("operation"));
+}
+
+
+Char const* findIntrinsicModifier(Core::Data::Ast::Definition const *def)
+{
+  return findStringModifier(def, S("intrinsic"));
+}
+
 }
@@ -144,6 +144,9 @@ s_enum(TypeInitMethod,
 
 Char const* findOperationModifier(Core::Data::Ast::Definition const *def);
 
+/// Get the name of the intrinsic a function definition is bound to using the @intrinsic modifier, if any.
+Char const* findIntrinsicModifier(Core::Data::Ast::Definition const *def);
+
 } // namespace
 
 
@@ -168,6 +171,7 @@ DEFINE_TYPE_NAME(Spp::Ast::CalleeLookupResult, "alusus.org/Spp/Spp.Ast.CalleeLoo
 #include "PointerType.h"
 #include "ReferenceType.h"
 #include "ArrayType.h"
+#include "VectorType.h"
 #include "UserType.h"
 #include "FunctionType.h"
 #include "Macro.h"
@@ -183,6 +187,7 @@ DEFINE_TYPE_NAME(Spp::Ast::CalleeLookupResult, "alusus.org/Spp/Spp.Ast.CalleeLoo
 #include "ContinueStatement.h"
 #include "BreakStatement.h"
 #include "ReturnStatement.h"
+#include "AtomicFenceStatement.h"
 #include "PreprocessStatement.h"
 // Operators
 #include "PointerOp.h"
@@ -196,6 +201,7 @@ DEFINE_TYPE_NAME(Spp::Ast::CalleeLookupResult, "alusus.org/Spp/Spp.Ast.CalleeLoo
 #include "InitOp.h"
 #include "TerminateOp.h"
 #include "NextArgOp.h"
+#include "AtomicOp.h"
 // Misc
 #include "ArgPack.h"
 #include "ThisTypeRef.h"
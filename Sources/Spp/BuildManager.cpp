@@ -37,6 +37,12 @@ void BuildManager::initBindingCaches()
     &this->execute,
     &this->dumpLlvmIrForElement,
     &this->buildObjectFileForElement,
+    &this->setOfflineBuildOptions,
+    &this->setOfflineIncrementalDir,
+    &this->setOfflineLtoMode,
+    &this->setOfflineProfileOptions,
+    &this->setJitOptLevel,
+    &this->getJitOptLevel,
     &this->resetBuild,
     &this->resetBuildData
   });
@@ -59,6 +65,12 @@ void BuildManager::initBindings()
   this->execute = &BuildManager::_execute;
   this->dumpLlvmIrForElement = &BuildManager::_dumpLlvmIrForElement;
   this->buildObjectFileForElement = &BuildManager::_buildObjectFileForElement;
+  this->setOfflineBuildOptions = &BuildManager::_setOfflineBuildOptions;
+  this->setOfflineIncrementalDir = &BuildManager::_setOfflineIncrementalDir;
+  this->setOfflineLtoMode = &BuildManager::_setOfflineLtoMode;
+  this->setOfflineProfileOptions = &BuildManager::_setOfflineProfileOptions;
+  this->setJitOptLevel = &BuildManager::_setJitOptLevel;
+  this->getJitOptLevel = &BuildManager::_getJitOptLevel;
   this->resetBuild = &BuildManager::_resetBuild;
   this->resetBuildData = &BuildManager::_resetBuildData;
 }
@@ -68,7 +80,7 @@ void BuildManager::initTargets()
 {
   this->jitEda.setIdPrefix("jit");
   this->jitBuildTarget = newSrdObj<LlvmCodeGen::JitBuildTarget>(this->globalItemRepo);
-  this->jitTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(this->jitBuildTarget.get(), false);
+  this->jitTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(this->jitBuildTarget.get(), true);
   this->jitTargetGenerator->setupBuild();
 
   this->preprocessEda.setIdPrefix("preprc");
@@ -81,7 +93,7 @@ void BuildManager::initTargets()
   this->offlineEda.setIdPrefix("ofln");
   this->offlineBuildTarget = newSrdObj<LlvmCodeGen::OfflineBuildTarget>();
   this->offlineTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
-    this->jitTargetGenerator.get(), this->offlineBuildTarget.get(), false
+    this->jitTargetGenerator.get(), this->offlineBuildTarget.get(), true
   );
   this->offlineTargetGenerator->setupBuild();
 }
@@ -222,7 +234,8 @@ Bool BuildManager::_execute(TiObject *self, Core::Notices::Store *noticeStore, B
   if ((minSeverity == -1 || minSeverity > 1) && (thisMinSeverity == -1 || thisMinSeverity > 1)) {
     if (buildSession->getBuildType() == BuildType::JIT) {
       // First run all the constructors. Constructors need to be run in reverse order since the deeper dependencies
-      // are generated after the immediate dependencies.
+      // are generated after the immediate dependencies. Each execution blocks on the lookup of its entry until the
+      // entry and its dependencies are materialized, so the order holds even with concurrent compile threads.
       for (Int i = buildSession->getGlobalCtorNames()->size() - 1; i >= 0; --i) {
         buildMgr->jitBuildTarget->execute(buildSession->getGlobalCtorNames()->at(i));
       }
@@ -260,8 +273,7 @@ Bool BuildManager::_buildDependencies(TiObject *self, Core::Notices::Store *noti
   ) {
     // Build function dependencies.
     while (buildSession->getDepsInfo()->funcDeps.getCount() > 0) {
-      auto astFunc = static_cast<Ast::Function*>(buildSession->getDepsInfo()->funcDeps.get(0));
-      buildSession->getDepsInfo()->funcDeps.remove(0);
+      auto astFunc = buildSession->getDepsInfo()->funcDeps.pop();
       if (!generation->generateFunction(astFunc, buildSession->getCodeGenSession())) result = false;
     }
 
@@ -364,8 +376,7 @@ Bool BuildManager::buildGlobalCtorOrDtor(
   Bool result = true;
 
   while (deps->getCount() > 0) {
-    auto astVar = deps->get(0);
-    deps->remove(0);
+    auto astVar = deps->pop();
     TiObject *tgVar = session.getEda()->getCodeGenData<TiObject>(astVar);
 
     // Get initialization params, if any.
@@ -483,6 +494,73 @@ Bool BuildManager::_buildObjectFileForElement(
 }
 
 
+void BuildManager::_setOfflineBuildOptions(
+  TiObject *self, Word optLevel, Word sizeLevel, Char const *cpu, Char const *cpuFeatures
+) {
+  PREPARE_SELF(buildMgr, BuildManager);
+  // All options are validated before any of them is applied so that an invalid option doesn't leave the target with
+  // a partially applied configuration.
+  LlvmCodeGen::OfflineBuildTarget::validateOptLevel(optLevel);
+  LlvmCodeGen::OfflineBuildTarget::validateSizeLevel(sizeLevel);
+  // The new options are applied when the offline target is set up for the next build.
+  buildMgr->offlineBuildTarget->setOptLevel(optLevel);
+  buildMgr->offlineBuildTarget->setSizeLevel(sizeLevel);
+  buildMgr->offlineBuildTarget->setCpu(cpu, cpuFeatures);
+}
+
+
+void BuildManager::_setOfflineIncrementalDir(TiObject *self, Char const *dir)
+{
+  PREPARE_SELF(buildMgr, BuildManager);
+  buildMgr->offlineBuildTarget->setIncrementalDir(dir);
+}
+
+
+void BuildManager::_setOfflineLtoMode(TiObject *self, Word mode)
+{
+  PREPARE_SELF(buildMgr, BuildManager);
+  if (mode > LlvmCodeGen::OfflineBuildTarget::LtoMode::THIN) {
+    throw EXCEPTION(InvalidArgumentException, S("mode"), S("Unexpected LTO mode."), mode);
+  }
+  buildMgr->offlineBuildTarget->setLtoMode(mode);
+}
+
+
+void BuildManager::_setOfflineProfileOptions(
+  TiObject *self, Char const *generateFilename, Char const *useFilename
+) {
+  PREPARE_SELF(buildMgr, BuildManager);
+  buildMgr->offlineBuildTarget->setProfileGenerateFilename(generateFilename);
+  buildMgr->offlineBuildTarget->setProfileUseFilename(useFilename);
+}
+
+
+void BuildManager::_setJitOptLevel(TiObject *self, Int buildType, Word optLevel)
+{
+  PREPARE_SELF(buildMgr, BuildManager);
+  if (buildType == BuildType::JIT) {
+    buildMgr->jitBuildTarget->setOptLevel(optLevel);
+  } else if (buildType == BuildType::PREPROCESS) {
+    buildMgr->preprocessBuildTarget->setOptLevel(optLevel);
+  } else {
+    throw EXCEPTION(InvalidArgumentException, S("buildType"), S("Unexpected build type."), buildType);
+  }
+}
+
+
+Word BuildManager::_getJitOptLevel(TiObject *self, Int buildType)
+{
+  PREPARE_SELF(buildMgr, BuildManager);
+  if (buildType == BuildType::JIT) {
+    return buildMgr->jitBuildTarget->getOptLevel();
+  } else if (buildType == BuildType::PREPROCESS) {
+    return buildMgr->preprocessBuildTarget->getOptLevel();
+  } else {
+    throw EXCEPTION(InvalidArgumentException, S("buildType"), S("Unexpected build type."), buildType);
+  }
+}
+
+
 void BuildManager::_resetBuild(TiObject *self, Int buildType)
 {
   PREPARE_SELF(buildMgr, BuildManager);
@@ -595,6 +673,9 @@ void BuildManager::prepareFunction(
   if (!targetGen->generateFunctionDecl(funcName, tgFuncType, tgFunc)) {
     throw EXCEPTION(GenericException, S("Failed to generate function declaration for root scope execution."));
   }
+  // Root scope execution functions and global constructors and destructors only run once.
+  auto llvmFunc = tgFunc.ti_cast_get<LlvmCodeGen::Function>();
+  if (llvmFunc != 0) llvmFunc->setOneShot(true);
   SharedList<TiObject> args;
   if (!targetGen->prepareFunctionBody(
     tgFunc.get(), tgFuncType, &args, context)
@@ -193,6 +193,28 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
     Core::Notices::Store *noticeStore, Core::Processing::Parser *parser
   );
 
+  public: METHOD_BINDING_CACHE(setOfflineBuildOptions, void, (Word, Word, Char const*, Char const*));
+  private: static void _setOfflineBuildOptions(
+    TiObject *self, Word optLevel, Word sizeLevel, Char const *cpu, Char const *cpuFeatures
+  );
+
+  public: METHOD_BINDING_CACHE(setOfflineIncrementalDir, void, (Char const*));
+  private: static void _setOfflineIncrementalDir(TiObject *self, Char const *dir);
+
+  public: METHOD_BINDING_CACHE(setOfflineLtoMode, void, (Word));
+  private: static void _setOfflineLtoMode(TiObject *self, Word mode);
+
+  public: METHOD_BINDING_CACHE(setOfflineProfileOptions, void, (Char const*, Char const*));
+  private: static void _setOfflineProfileOptions(
+    TiObject *self, Char const *generateFilename, Char const *useFilename
+  );
+
+  public: METHOD_BINDING_CACHE(setJitOptLevel, void, (Int, Word));
+  private: static void _setJitOptLevel(TiObject *self, Int buildType, Word optLevel);
+
+  public: METHOD_BINDING_CACHE(getJitOptLevel, Word, (Int));
+  private: static Word _getJitOptLevel(TiObject *self, Int buildType);
+
   public: METHOD_BINDING_CACHE(resetBuild, void, (Int));
   private: static void _resetBuild(TiObject *self, Int buildType);
 
@@ -26,7 +26,8 @@ void CommandGenerator::initBindingCaches()
     &this->generateWhileStatement,
     &this->generateForStatement,
     &this->generateContinueStatement,
-    &this->generateBreakStatement
+    &this->generateBreakStatement,
+    &this->generateAtomicFenceStatement
   });
 }
 
@@ -39,6 +40,7 @@ void CommandGenerator::initBindings()
   this->generateForStatement = &CommandGenerator::_generateForStatement;
   this->generateContinueStatement = &CommandGenerator::_generateContinueStatement;
   this->generateBreakStatement = &CommandGenerator::_generateBreakStatement;
+  this->generateAtomicFenceStatement = &CommandGenerator::_generateAtomicFenceStatement;
 }
 
 
@@ -359,6 +361,24 @@ Bool CommandGenerator::_generateBreakStatement(
 }
 
 
+Bool CommandGenerator::_generateAtomicFenceStatement(
+  TiObject *self, Spp::Ast::AtomicFenceStatement *astNode, Generation *g, Session *session
+) {
+  PREPARE_SELF(cmdGenerator, CommandGenerator);
+
+  // Relaxed fences don't order anything, so we reject them.
+  AtomicOrdering order;
+  if (!parseAtomicOrdering(astNode->getOperand().get(), order) || order == AtomicOrdering::RELAXED) {
+    cmdGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+
+  return session->getTg()->generateAtomicFence(session->getTgContext(), order);
+}
+
+
 //==============================================================================
 // Helper Functions
 
@@ -51,6 +51,7 @@ void ExpressionGenerator::initBindingCaches()
     &this->generateInitOp,
     &this->generateTerminateOp,
     &this->generateNextArgOp,
+    &this->generateAtomicOp,
     &this->generateStringLiteral,
     &this->generateCharLiteral,
     &this->generateIntegerLiteral,
@@ -101,6 +102,7 @@ void ExpressionGenerator::initBindings()
   this->generateInitOp = &ExpressionGenerator::_generateInitOp;
   this->generateTerminateOp = &ExpressionGenerator::_generateTerminateOp;
   this->generateNextArgOp = &ExpressionGenerator::_generateNextArgOp;
+  this->generateAtomicOp = &ExpressionGenerator::_generateAtomicOp;
   this->generateStringLiteral = &ExpressionGenerator::_generateStringLiteral;
   this->generateCharLiteral = &ExpressionGenerator::_generateCharLiteral;
   this->generateIntegerLiteral = &ExpressionGenerator::_generateIntegerLiteral;
@@ -176,6 +178,9 @@ Bool ExpressionGenerator::_generate(
   } else if (astNode->isDerivedFrom<Spp::Ast::NextArgOp>()) {
     auto nextArgOp = static_cast<Spp::Ast::NextArgOp*>(astNode);
     return expGenerator->generateNextArgOp(nextArgOp, g, session, result);
+  } else if (astNode->isDerivedFrom<Spp::Ast::AtomicOp>()) {
+    auto atomicOp = static_cast<Spp::Ast::AtomicOp*>(astNode);
+    return expGenerator->generateAtomicOp(atomicOp, g, session, result);
   } else if (astNode->isDerivedFrom<Core::Data::Ast::StringLiteral>()) {
     auto stringLiteral = static_cast<Core::Data::Ast::StringLiteral*>(astNode);
     return expGenerator->generateStringLiteral(stringLiteral, g, session, result);
@@ -408,8 +413,11 @@ Bool ExpressionGenerator::_generateRoundParamPassOnCallee(
       }
       result.astType = astFuncType->traceRetType(expGenerator->astHelper);
       return true;
-    } else if (contentType != 0 && contentType->isDerivedFrom<Ast::ArrayType>()) {
-      //// Reference array element.
+    } else if (
+      contentType != 0 &&
+      (contentType->isDerivedFrom<Ast::ArrayType>() || contentType->isDerivedFrom<Ast::VectorType>())
+    ) {
+      //// Reference array or vector element.
       ////
       // Get a reference to the array.
       GenResult derefCallee;
@@ -702,7 +710,11 @@ Bool ExpressionGenerator::_generateArithmeticOp(
   Ast::Type *astTargetType = 0;
   Ast::Type *astOp2CastType = 0;
 
-  if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
+  if (param1.astType->isDerivedFrom<Ast::VectorType>() || param2.astType->isDerivedFrom<Ast::VectorType>()) {
+    // Element-wise operation on vectors.
+    if (!expGenerator->prepareVectorOperands(g, session, astNode, false, param1, param2)) return false;
+    astOp2CastType = astTargetType = param1.astType;
+  } else if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
     // Two floats.
     auto floatType1 = static_cast<Ast::FloatType*>(param1.astType);
     auto floatType2 = static_cast<Ast::FloatType*>(param2.astType);
@@ -838,7 +850,11 @@ Bool ExpressionGenerator::_generateBinaryOp(
   )) return false;
   Ast::Type *astTargetType = 0;
 
-  if (param1.astType->isDerivedFrom<Ast::IntegerType>() && param2.astType->isDerivedFrom<Ast::IntegerType>()) {
+  if (param1.astType->isDerivedFrom<Ast::VectorType>() || param2.astType->isDerivedFrom<Ast::VectorType>()) {
+    // Element-wise operation on vectors of integers.
+    if (!expGenerator->prepareVectorOperands(g, session, astNode, true, param1, param2)) return false;
+    astTargetType = param1.astType;
+  } else if (param1.astType->isDerivedFrom<Ast::IntegerType>() && param2.astType->isDerivedFrom<Ast::IntegerType>()) {
     // Two integers.
     auto integerType1 = static_cast<Ast::IntegerType*>(param1.astType);
     auto integerType2 = static_cast<Ast::IntegerType*>(param2.astType);
@@ -944,8 +960,26 @@ Bool ExpressionGenerator::_generateComparisonOp(
     static_cast<Ast::Type*>(paramAstTypes->get(1)), paramTgValues->getElement(1), true, false, session, param2
   )) return false;
   Ast::Type *astTargetType = 0;
+  Ast::Type *astResultType = expGenerator->astHelper->getBoolType();
 
-  if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
+  if (param1.astType->isDerivedFrom<Ast::VectorType>() || param2.astType->isDerivedFrom<Ast::VectorType>()) {
+    // Element-wise comparison of vectors, resulting in a mask vector of integers with the same size as the elements.
+    if (!expGenerator->prepareVectorOperands(g, session, astNode, false, param1, param2)) return false;
+    astTargetType = param1.astType;
+    auto astVectorType = static_cast<Ast::VectorType*>(astTargetType);
+    auto astElementType = astVectorType->getContentType(expGenerator->astHelper);
+    Word bitCount;
+    if (astElementType->isDerivedFrom<Ast::IntegerType>()) {
+      bitCount = static_cast<Ast::IntegerType*>(astElementType)->getBitCount(
+        expGenerator->astHelper, session->getExecutionContext()
+      );
+    } else {
+      bitCount = static_cast<Ast::FloatType*>(astElementType)->getBitCount(expGenerator->astHelper);
+    }
+    astResultType = expGenerator->astHelper->getIntVectorType(
+      bitCount, astVectorType->getSize(expGenerator->astHelper)
+    );
+  } else if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
     // Two floats.
     auto floatType1 = static_cast<Ast::FloatType*>(param1.astType);
     auto floatType2 = static_cast<Ast::FloatType*>(param2.astType);
@@ -1028,7 +1062,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("!=")) {
     if (session->getTgContext() != 0) {
@@ -1036,7 +1070,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S(">")) {
     if (session->getTgContext() != 0) {
@@ -1044,7 +1078,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S(">=")) {
     if (session->getTgContext() != 0) {
@@ -1052,7 +1086,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("<")) {
     if (session->getTgContext() != 0) {
@@ -1060,7 +1094,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("<=")) {
     if (session->getTgContext() != 0) {
@@ -1068,7 +1102,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else {
     throw EXCEPTION(InvalidArgumentException, S("astNode"), S("Does not represent a comparison operator."));
@@ -1302,7 +1336,9 @@ Bool ExpressionGenerator::_generateUnaryValOp(
   }
 
   Ast::Type *astTargetType = 0;
-  if (param.astType->isDerivedFrom<Ast::FloatType>()) {
+  if (param.astType->isDerivedFrom<Ast::VectorType>()) {
+    astTargetType = param.astType;
+  } else if (param.astType->isDerivedFrom<Ast::FloatType>()) {
     astTargetType = static_cast<Ast::FloatType*>(param.astType);
   } else if (param.astType->isDerivedFrom<Ast::IntegerType>()) {
     auto integerType = static_cast<Ast::IntegerType*>(param.astType);
@@ -2028,6 +2064,190 @@ Bool ExpressionGenerator::_generateNextArgOp(
 }
 
 
+Bool ExpressionGenerator::_generateAtomicOp(
+  TiObject *self, Spp::Ast::AtomicOp *astNode, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+
+  // Generate the operand.
+  auto operand = astNode->getOperand().get();
+  if (operand == 0) {
+    throw EXCEPTION(GenericException, S("AtomicOp operand is missing."));
+  }
+  GenResult operandResult;
+  if (!expGenerator->generate(operand, g, session, operandResult)) return false;
+  if (operandResult.astType == 0) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+
+  // Dereference and get content type, which must be an integer or a pointer.
+  GenResult target;
+  if (!expGenerator->dereferenceIfNeeded(
+    static_cast<Ast::Type*>(operandResult.astType), operandResult.targetData.get(), false, false, session, target
+  )) return false;
+  auto astRefType = ti_cast<Ast::ReferenceType>(target.astType);
+  Ast::Type *astContentType = astRefType == 0 ? 0 : astRefType->getContentType(expGenerator->astHelper);
+  Bool isInteger = false;
+  if (astContentType != 0 && astContentType->isDerivedFrom<Ast::IntegerType>()) {
+    auto bitCount = static_cast<Ast::IntegerType*>(astContentType)->getBitCount(
+      expGenerator->astHelper, session->getExecutionContext()
+    );
+    isInteger = bitCount >= 8 && (bitCount & (bitCount - 1)) == 0;
+  }
+  if (!isInteger && (astContentType == 0 || !astContentType->isDerivedFrom<Ast::PointerType>())) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+
+  // The param is a list of the operation name, the operation's args, and an optional memory ordering.
+  PlainList<TiObject> args;
+  auto param = astNode->getParam().get();
+  if (param != 0 && param->isDerivedFrom<Core::Data::Ast::List>()) {
+    auto list = static_cast<Core::Data::Ast::List*>(param);
+    for (Int i = 0; i < list->getElementCount(); ++i) args.add(list->getElement(i));
+  } else if (param != 0) {
+    args.add(param);
+  }
+
+  // Determine the operation.
+  auto opIdentifier = args.getCount() > 0 ? ti_cast<Core::Data::Ast::Identifier>(args.get(0)) : 0;
+  if (opIdentifier == 0) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+  auto const &opName = opIdentifier->getValue();
+  Bool isLoad = false;
+  Bool isStore = false;
+  Bool isCmpXchg = false;
+  AtomicRmwOp rmwOp = AtomicRmwOp::XCHG;
+  Int argCount = 1;
+  if (opName == S("load")) {
+    isLoad = true;
+    argCount = 0;
+  } else if (opName == S("store")) {
+    isStore = true;
+  } else if (opName == S("compare_exchange")) {
+    isCmpXchg = true;
+    argCount = 2;
+  } else if (opName == S("exchange")) {
+    rmwOp = AtomicRmwOp::XCHG;
+  } else if (opName == S("fetch_add")) {
+    rmwOp = AtomicRmwOp::ADD;
+  } else if (opName == S("fetch_sub")) {
+    rmwOp = AtomicRmwOp::SUB;
+  } else if (opName == S("fetch_and")) {
+    rmwOp = AtomicRmwOp::AND;
+  } else if (opName == S("fetch_or")) {
+    rmwOp = AtomicRmwOp::OR;
+  } else if (opName == S("fetch_xor")) {
+    rmwOp = AtomicRmwOp::XOR;
+  } else {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+  // Pointers can only be loaded, stored, or exchanged atomically.
+  if (!isInteger && !isLoad && !isStore && !isCmpXchg && rmwOp != AtomicRmwOp::XCHG) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicPointerOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+
+  // Determine the memory ordering. Loads can't release and stores can't acquire.
+  AtomicOrdering order;
+  if (
+    (args.getCount() != argCount + 1 && args.getCount() != argCount + 2) ||
+    !parseAtomicOrdering(args.getCount() == argCount + 2 ? args.get(argCount + 1) : 0, order) ||
+    (isLoad && (order == AtomicOrdering::RELEASE || order == AtomicOrdering::ACQ_REL)) ||
+    (isStore && (order == AtomicOrdering::ACQUIRE || order == AtomicOrdering::ACQ_REL))
+  ) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+
+  // Generate the args and cast them to the content type.
+  TioSharedPtr argTgValues[2];
+  for (Int i = 0; i < argCount; ++i) {
+    auto arg = args.get(i + 1);
+    GenResult argResult;
+    if (!expGenerator->generate(arg, g, session, argResult)) return false;
+    if (argResult.astType == 0) {
+      expGenerator->noticeStore->add(
+        newSrdObj<Spp::Notices::InvalidReferenceNotice>(Core::Data::Ast::findSourceLocation(arg))
+      );
+      return false;
+    }
+    Bool castable;
+    if (session->getTgContext() != 0) {
+      GenResult castResult;
+      castable = g->generateCast(
+        session, argResult.astType, astContentType, astNode, argResult.targetData.get(), true, castResult
+      );
+      argTgValues[i] = castResult.targetData;
+    } else {
+      castable = expGenerator->astHelper->isImplicitlyCastableTo(
+        argResult.astType, astContentType, session->getExecutionContext()
+      );
+    }
+    if (!castable) {
+      expGenerator->noticeStore->add(
+        newSrdObj<Spp::Notices::IncompatibleOperatorTypesNotice>(astNode->findSourceLocation())
+      );
+      return false;
+    }
+  }
+
+  TiObject *tgContentType;
+  if (!g->getGeneratedType(astContentType, session, tgContentType, 0)) return false;
+
+  if (isLoad) {
+    if (session->getTgContext() != 0) {
+      if (!session->getTg()->generateAtomicLoad(
+        session->getTgContext(), tgContentType, target.targetData.get(), order, result.targetData
+      )) return false;
+    }
+    result.astType = astContentType;
+  } else if (isStore) {
+    if (session->getTgContext() != 0) {
+      if (!session->getTg()->generateAtomicStore(
+        session->getTgContext(), tgContentType, argTgValues[0].get(), target.targetData.get(), order,
+        result.targetData
+      )) return false;
+    }
+    result.astType = astRefType;
+  } else if (isCmpXchg) {
+    // The result is the previous value, so the exchange succeeded if the result equals the expected value.
+    if (session->getTgContext() != 0) {
+      if (!session->getTg()->generateAtomicCmpXchg(
+        session->getTgContext(), tgContentType, target.targetData.get(), argTgValues[0].get(),
+        argTgValues[1].get(), order, result.targetData
+      )) return false;
+    }
+    result.astType = astContentType;
+  } else {
+    if (session->getTgContext() != 0) {
+      if (!session->getTg()->generateAtomicRmw(
+        session->getTgContext(), tgContentType, rmwOp, target.targetData.get(), argTgValues[0].get(), order,
+        result.targetData
+      )) return false;
+    }
+    result.astType = astContentType;
+  }
+  return true;
+}
+
+
 Bool ExpressionGenerator::_generateStringLiteral(
   TiObject *self, Core::Data::Ast::StringLiteral *astNode, Generation *g, Session *session, GenResult &result
 ) {
@@ -2393,13 +2613,16 @@ Bool ExpressionGenerator::_generateArrayReference(
     auto astPtrType = expGenerator->astHelper->getPointerTypeFor(astType);
     if (!g->getGeneratedType(astPtrType, session, tgArrayType, 0)) return false;
   }
-  auto astArrayType = ti_cast<Ast::ArrayType>(astType);
-  if (astArrayType == 0) {
-    throw EXCEPTION(GenericException, S("Unexpected type for array reference."));
-  }
 
   // Find element type.
-  auto astElementType = astArrayType->getContentType(expGenerator->astHelper);
+  Ast::Type *astElementType;
+  if (astType->isDerivedFrom<Ast::ArrayType>()) {
+    astElementType = static_cast<Ast::ArrayType*>(astType)->getContentType(expGenerator->astHelper);
+  } else if (astType->isDerivedFrom<Ast::VectorType>()) {
+    astElementType = static_cast<Ast::VectorType*>(astType)->getContentType(expGenerator->astHelper);
+  } else {
+    throw EXCEPTION(GenericException, S("Unexpected type for array reference."));
+  }
   TiObject *tgElementType;
   if (!g->getGeneratedType(astElementType, session, tgElementType, 0)) return false;
 
@@ -2422,6 +2645,12 @@ Bool ExpressionGenerator::_generateFunctionCall(
 ) {
   PREPARE_SELF(expGenerator, ExpressionGenerator);
 
+  auto def = callee->findOwner<Core::Data::Ast::Definition>();
+  auto intrinsic = def == 0 ? 0 : Ast::findIntrinsicModifier(def);
+  if (intrinsic != 0) {
+    return expGenerator->generateIntrinsicCall(intrinsic, astNode, callee, paramTgValues, g, session, result);
+  }
+
   if (callee->getInlined()) {
     // TODO: Generate inlined function body.
     throw EXCEPTION(GenericException, S("Inline function generation is not implemented yet."));
@@ -2799,6 +3028,115 @@ Bool ExpressionGenerator::dereferenceIfNeeded(
 }
 
 
+Bool ExpressionGenerator::prepareVectorOperands(
+  Generation *g, Session *session, Core::Data::Ast::InfixOperator *astNode, Bool integersOnly,
+  GenResult &param1, GenResult &param2
+) {
+  auto astVectorType = ti_cast<Ast::VectorType>(param1.astType);
+  if (astVectorType == 0) astVectorType = static_cast<Ast::VectorType*>(param2.astType);
+  auto astElementType = astVectorType->getContentType(this->astHelper);
+
+  Bool compatible;
+  if (param1.astType->isDerivedFrom<Ast::VectorType>() && param2.astType->isDerivedFrom<Ast::VectorType>()) {
+    compatible = param1.astType->isEqual(param2.astType, this->astHelper, session->getExecutionContext());
+  } else {
+    auto astScalarType = param1.astType == astVectorType ? param2.astType : param1.astType;
+    compatible = astScalarType->isDerivedFrom<Ast::IntegerType>() || astScalarType->isDerivedFrom<Ast::FloatType>();
+  }
+  if (!compatible || (integersOnly && !astElementType->isDerivedFrom<Ast::IntegerType>())) {
+    this->noticeStore->add(newSrdObj<Spp::Notices::IncompatibleOperatorTypesNotice>(astNode->findSourceLocation()));
+    return false;
+  }
+
+  // Copy scalar operands into all elements of a vector.
+  TiObject *tgVectorType;
+  if (!g->getGeneratedType(astVectorType, session, tgVectorType, 0)) return false;
+  for (auto param : { &param1, &param2 }) {
+    if (param->astType->isDerivedFrom<Ast::VectorType>()) continue;
+    if (session->getTgContext() != 0) {
+      GenResult castedParam;
+      if (!g->generateCast(
+        session, param->astType, astElementType, astNode, param->targetData.get(), false, castedParam
+      )) {
+        throw EXCEPTION(GenericException, S("Casting unexpectedly failed."));
+      }
+      if (!session->getTg()->generateVectorSplat(
+        session->getTgContext(), tgVectorType, castedParam.targetData.get(), param->targetData
+      )) return false;
+    }
+    param->astType = astVectorType;
+  }
+  return true;
+}
+
+
+Bool ExpressionGenerator::generateIntrinsicCall(
+  Char const *intrinsic, Core::Data::Node *astNode, Spp::Ast::Function *callee,
+  Containing<TiObject> *paramTgValues, Generation *g, Session *session, GenResult &result
+) {
+  // All intrinsics operate on a vector type, which is either the type of one of the args or the return type.
+  auto astFuncType = callee->getType().get();
+  auto astRetType = astFuncType->traceRetType(this->astHelper);
+  Ast::VectorType *astVectorType = 0;
+  for (Int i = 0; i < astFuncType->getArgCount() && astVectorType == 0; ++i) {
+    astVectorType = ti_cast<Ast::VectorType>(astFuncType->traceArgType(i, this->astHelper));
+  }
+  if (astVectorType == 0) astVectorType = ti_cast<Ast::VectorType>(astRetType);
+
+  // Validate the intrinsic and the number of args.
+  Str name = intrinsic;
+  Word argCount = paramTgValues->getElementCount();
+  Bool valid;
+  if (name == S("vector_load") || name == S("vector_splat")) {
+    valid = argCount == 1 && astRetType == astVectorType;
+  } else if (name == S("vector_store")) {
+    valid = argCount == 2;
+  } else if (
+    name == S("vector_sum") || name == S("vector_product") || name == S("vector_min") || name == S("vector_max")
+  ) {
+    valid = argCount == 1 && astRetType != astVectorType;
+  } else if (name == S("vector_reverse")) {
+    valid = argCount == 1 && astRetType == astVectorType;
+  } else if (name == S("vector_rotate")) {
+    valid = argCount == 2 && astRetType == astVectorType;
+  } else {
+    valid = false;
+  }
+  if (!valid || astVectorType == 0) {
+    this->noticeStore->add(newSrdObj<Spp::Notices::InvalidIntrinsicNotice>(Core::Data::Ast::findSourceLocation(astNode)));
+    return false;
+  }
+
+  result.astType = astRetType;
+  TiObject *tgVectorType;
+  if (!g->getGeneratedType(astVectorType, session, tgVectorType, 0)) return false;
+  if (session->getTgContext() == 0) return true;
+
+  auto tg = session->getTg();
+  auto tgContext = session->getTgContext();
+  if (name == S("vector_load")) {
+    return tg->generateVectorLoad(tgContext, tgVectorType, paramTgValues->getElement(0), result.targetData);
+  } else if (name == S("vector_store")) {
+    return tg->generateVectorStore(
+      tgContext, tgVectorType, paramTgValues->getElement(1), paramTgValues->getElement(0)
+    );
+  } else if (name == S("vector_splat")) {
+    return tg->generateVectorSplat(tgContext, tgVectorType, paramTgValues->getElement(0), result.targetData);
+  } else if (name == S("vector_reverse")) {
+    return tg->generateVectorReverse(tgContext, tgVectorType, paramTgValues->getElement(0), result.targetData);
+  } else if (name == S("vector_rotate")) {
+    return tg->generateVectorRotate(
+      tgContext, tgVectorType, paramTgValues->getElement(0), paramTgValues->getElement(1), result.targetData
+    );
+  } else {
+    // Reductions are named after their operation: vector_sum, vector_product, vector_min, and vector_max.
+    return tg->generateVectorReduction(
+      tgContext, intrinsic + sizeof("vector_") - 1, tgVectorType, paramTgValues->getElement(0), result.targetData
+    );
+  }
+}
+
+
 Bool ExpressionGenerator::castLogicalOperand(
   Generation *g, Session *session, TiObject *astNode, Spp::Ast::Type *astType,
   TiObject *tgValue, TioSharedPtr &result
@@ -433,6 +433,15 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     TiObject *self, Spp::Ast::NextArgOp *astNode, Generation *g, Session *session, GenResult &result
   );
 
+  public: METHOD_BINDING_CACHE(generateAtomicOp,
+    Bool, (
+      Spp::Ast::AtomicOp* /* astNode */, Generation* /* g */, Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateAtomicOp(
+    TiObject *self, Spp::Ast::AtomicOp *astNode, Generation *g, Session *session, GenResult &result
+  );
+
   public: METHOD_BINDING_CACHE(generateStringLiteral,
     Bool, (
       Core::Data::Ast::StringLiteral* /* astNode */, Generation* /* g */,
@@ -602,6 +611,27 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     Spp::Ast::Type *astType, TiObject *tgValue, Bool valueNeeded, Bool implicitOnly, Session *session, GenResult &result
   );
 
+  /**
+   * @brief Prepare the operands of a binary operation that involves vectors.
+   * Both operands end up with the same vector type. A scalar operand is cast
+   * into the vector's element type then copied into all the elements of a new
+   * vector.
+   */
+  private: Bool prepareVectorOperands(
+    Generation *g, Session *session, Core::Data::Ast::InfixOperator *astNode, Bool integersOnly,
+    GenResult &param1, GenResult &param2
+  );
+
+  /**
+   * @brief Generate a call to a function bound to an intrinsic operation.
+   * Functions marked with the @intrinsic modifier have no body and their calls
+   * are generated directly into vector instructions.
+   */
+  private: Bool generateIntrinsicCall(
+    Char const *intrinsic, Core::Data::Node *astNode, Spp::Ast::Function *callee,
+    Containing<TiObject> *paramTgValues, Generation *g, Session *session, GenResult &result
+  );
+
   private: Bool castLogicalOperand(
     Generation *g, Session *session, TiObject *astNode, Spp::Ast::Type *astType,
     TiObject *tgValue, TioSharedPtr &result
@@ -42,13 +42,13 @@ class ExtraDataAccessor : public TiObject
   // Member Variables
 
   private: Str idPrefix;
-  private: Str idCodeGenData;
-  private: Str idAutoCtor;
-  private: Str idAutoCtorType;
-  private: Str idAutoDtor;
-  private: Str idAutoDtorType;
-  private: Str idCodeGenFailed;
-  private: Str idInitStatementGenIndex;
+  private: Word idCodeGenData;
+  private: Word idAutoCtor;
+  private: Word idAutoCtorType;
+  private: Word idAutoDtor;
+  private: Word idAutoDtorType;
+  private: Word idCodeGenFailed;
+  private: Word idInitStatementGenIndex;
 
 
   //============================================================================
@@ -63,16 +63,22 @@ class ExtraDataAccessor : public TiObject
   //============================================================================
   // Member Functions
 
+  /**
+   * @brief Set the prefix that distinguishes this accessor's data from other accessors.
+   *
+   * The extras of each prefix are registered once as MetaHaving extra slots,
+   * giving each prefix its own range of slots.
+   */
   public: void setIdPrefix(Char const *prefix)
   {
     this->idPrefix = prefix;
-    this->idCodeGenData = this->idPrefix + S("codeGenData");
-    this->idAutoCtor = this->idPrefix + S("autoCtor");
-    this->idAutoCtorType = this->idPrefix + S("autoCtorType");
-    this->idAutoDtor = this->idPrefix + S("autoDtor");
-    this->idAutoDtorType = this->idPrefix + S("autoDtorType");
-    this->idCodeGenFailed = this->idPrefix + S("codeGenFailed");
-    this->idInitStatementGenIndex = this->idPrefix + S("initStatementGenIndex");
+    this->idCodeGenData = Core::Data::Ast::getExtraSlot(this->idPrefix + S("codeGenData"));
+    this->idAutoCtor = Core::Data::Ast::getExtraSlot(this->idPrefix + S("autoCtor"));
+    this->idAutoCtorType = Core::Data::Ast::getExtraSlot(this->idPrefix + S("autoCtorType"));
+    this->idAutoDtor = Core::Data::Ast::getExtraSlot(this->idPrefix + S("autoDtor"));
+    this->idAutoDtorType = Core::Data::Ast::getExtraSlot(this->idPrefix + S("autoDtorType"));
+    this->idCodeGenFailed = Core::Data::Ast::getExtraSlot(this->idPrefix + S("codeGenFailed"));
+    this->idInitStatementGenIndex = Core::Data::Ast::getExtraSlot(this->idPrefix + S("initStatementGenIndex"));
   }
 
   public: Str const& getIdPrefix() const
@@ -948,6 +948,9 @@ Bool Generator::_generateStatement(
     terminal = TerminalStatement::YES;
     auto returnStatement = static_cast<Spp::Ast::ReturnStatement*>(astNode);
     retVal = generator->commandGenerator->generateReturnStatement(returnStatement, generation, session);
+  } else if (astNode->isDerivedFrom<Spp::Ast::AtomicFenceStatement>()) {
+    auto fenceStatement = static_cast<Spp::Ast::AtomicFenceStatement*>(astNode);
+    retVal = generator->commandGenerator->generateAtomicFenceStatement(fenceStatement, generation, session);
   } else if (astNode->isDerivedFrom<Core::Data::Ast::Bridge>()) {
     retVal = generator->astHelper->validateUseStatement(static_cast<Core::Data::Ast::Bridge*>(astNode));
   } else {
@@ -41,6 +41,7 @@ class TargetGeneration : public ObjTiInterface
       &this->generateFloatType,
       &this->generatePointerType,
       &this->generateArrayType,
+      &this->generateVectorType,
       &this->generateStructTypeDecl,
       &this->generateStructTypeBody,
       &this->getTypeAllocationSize,
@@ -100,6 +101,16 @@ class TargetGeneration : public ObjTiInterface
       &this->generateOrAssign,
       &this->generateXorAssign,
       &this->generateNextArg,
+      &this->generateAtomicLoad,
+      &this->generateAtomicStore,
+      &this->generateAtomicRmw,
+      &this->generateAtomicCmpXchg,
+      &this->generateAtomicFence,
+      &this->generateVectorLoad,
+      &this->generateVectorStore,
+      &this->generateVectorReduction,
+      &this->generateVectorReverse,
+      &this->generateVectorRotate,
       &this->generateEqual,
       &this->generateNotEqual,
       &this->generateGreaterThan,
@@ -112,6 +123,8 @@ class TargetGeneration : public ObjTiInterface
       &this->generateNullPtrLiteral,
       &this->generateStructLiteral,
       &this->generateArrayLiteral,
+      &this->generateVectorLiteral,
+      &this->generateVectorSplat,
       &this->generatePointerLiteral
     });
   }
@@ -158,6 +171,10 @@ class TargetGeneration : public ObjTiInterface
     Bool, (TiObject* /* contentType */, Word /* size */, TioSharedPtr& /* type */)
   );
 
+  public: METHOD_BINDING_CACHE(generateVectorType,
+    Bool, (TiObject* /* contentType */, Word /* size */, TioSharedPtr& /* type */)
+  );
+
   public: METHOD_BINDING_CACHE(generateStructTypeDecl,
     Bool, (
       Char const* /* name */, TioSharedPtr& /* type */
@@ -561,6 +578,74 @@ class TargetGeneration : public ObjTiInterface
 
   /// @}
 
+  /// @name Atomic Ops Generation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(generateAtomicLoad,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* srcRef */, AtomicOrdering /* order */,
+      TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicStore,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* srcVal */, TiObject* /* destRef */,
+      AtomicOrdering /* order */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicRmw,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, AtomicRmwOp /* op */, TiObject* /* destRef */,
+      TiObject* /* srcVal */, AtomicOrdering /* order */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicCmpXchg,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* destRef */, TiObject* /* cmpVal */,
+      TiObject* /* newVal */, AtomicOrdering /* order */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicFence,
+    Bool, (TiObject* /* context */, AtomicOrdering /* order */)
+  );
+
+  /// @}
+
+  /// @name Vector Ops Generation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(generateVectorLoad,
+    Bool, (TiObject* /* context */, TiObject* /* type */, TiObject* /* srcPtr */, TioSharedPtr& /* result */)
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorStore,
+    Bool, (TiObject* /* context */, TiObject* /* type */, TiObject* /* srcVal */, TiObject* /* destPtr */)
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorReduction,
+    Bool, (
+      TiObject* /* context */, Char const* /* op */, TiObject* /* type */, TiObject* /* srcVal */,
+      TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorReverse,
+    Bool, (TiObject* /* context */, TiObject* /* type */, TiObject* /* srcVal */, TioSharedPtr& /* result */)
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorRotate,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* srcVal */, TiObject* /* countVal */,
+      TioSharedPtr& /* result */
+    )
+  );
+
+  /// @}
+
   /// @name Comparison Ops Generation Functions
   /// @{
 
@@ -650,6 +735,17 @@ class TargetGeneration : public ObjTiInterface
     )
   );
 
+  public: METHOD_BINDING_CACHE(generateVectorLiteral,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, Containing<TiObject>* /* membersVals */,
+      TioSharedPtr& /* destVal */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorSplat,
+    Bool, (TiObject* /* context */, TiObject* /* type */, TiObject* /* srcVal */, TioSharedPtr& /* result */)
+  );
+
   public: METHOD_BINDING_CACHE(generatePointerLiteral,
     Bool, (TiObject* /* context */, TiObject* /* type */, void* /* value */, TioSharedPtr& /* destVal */)
   );
@@ -29,6 +29,7 @@ void TypeGenerator::initBindingCaches()
     &this->generatePointerType,
     &this->generateReferenceType,
     &this->generateArrayType,
+    &this->generateVectorType,
     &this->generateUserType,
     &this->generateUserTypeMemberVars,
     &this->generateUserTypeAutoConstructor,
@@ -37,6 +38,7 @@ void TypeGenerator::initBindingCaches()
     &this->generateCast,
     &this->generateDefaultValue,
     &this->generateDefaultArrayValue,
+    &this->generateDefaultVectorValue,
     &this->generateDefaultUserTypeValue,
     &this->getTypeAllocationSize
   });
@@ -52,6 +54,7 @@ void TypeGenerator::initBindings()
   this->generatePointerType = &TypeGenerator::_generatePointerType;
   this->generateReferenceType = &TypeGenerator::_generateReferenceType;
   this->generateArrayType = &TypeGenerator::_generateArrayType;
+  this->generateVectorType = &TypeGenerator::_generateVectorType;
   this->generateUserType = &TypeGenerator::_generateUserType;
   this->generateUserTypeMemberVars = &TypeGenerator::_generateUserTypeMemberVars;
   this->generateUserTypeAutoConstructor = &TypeGenerator::_generateUserTypeAutoConstructor;
@@ -60,6 +63,7 @@ void TypeGenerator::initBindings()
   this->generateCast = &TypeGenerator::_generateCast;
   this->generateDefaultValue = &TypeGenerator::_generateDefaultValue;
   this->generateDefaultArrayValue = &TypeGenerator::_generateDefaultArrayValue;
+  this->generateDefaultVectorValue = &TypeGenerator::_generateDefaultVectorValue;
   this->generateDefaultUserTypeValue = &TypeGenerator::_generateDefaultUserTypeValue;
   this->getTypeAllocationSize = &TypeGenerator::_getTypeAllocationSize;
 }
@@ -145,6 +149,8 @@ Bool TypeGenerator::_generateType(TiObject *self, Spp::Ast::Type *astType, Gener
     return typeGenerator->generateReferenceType(static_cast<Spp::Ast::ReferenceType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::ArrayType>()) {
     return typeGenerator->generateArrayType(static_cast<Spp::Ast::ArrayType*>(astType), g, session);
+  } else if (astType->isDerivedFrom<Spp::Ast::VectorType>()) {
+    return typeGenerator->generateVectorType(static_cast<Spp::Ast::VectorType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::UserType>()) {
     return typeGenerator->generateUserType(static_cast<Spp::Ast::UserType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::FunctionType>()) {
@@ -245,6 +251,24 @@ Bool TypeGenerator::_generateArrayType(TiObject *self, Spp::Ast::ArrayType *astT
 }
 
 
+Bool TypeGenerator::_generateVectorType(TiObject *self, Spp::Ast::VectorType *astType, Generation *g, Session *session)
+{
+  PREPARE_SELF(typeGenerator, TypeGenerator);
+  auto contentAstType = astType->getContentType(typeGenerator->astHelper);
+  auto size = astType->getSize(typeGenerator->astHelper);
+  if (contentAstType == 0 || size == 0) {
+    typeGenerator->noticeStore->add(newSrdObj<Spp::Notices::InvalidVectorTypeNotice>(astType->findSourceLocation()));
+    return false;
+  }
+  if (!typeGenerator->generateType(contentAstType, g, session)) return false;
+  TiObject *contentTgType = session->getEda()->getCodeGenData<TiObject>(contentAstType);
+  TioSharedPtr tgType;
+  if (!session->getTg()->generateVectorType(contentTgType, size, tgType)) return false;
+  session->getEda()->setCodeGenData(astType, tgType);
+  return true;
+}
+
+
 Bool TypeGenerator::_generateUserType(TiObject *self, Spp::Ast::UserType *astType, Generation *g, Session *session)
 {
   PREPARE_SELF(typeGenerator, TypeGenerator);
@@ -825,6 +849,9 @@ Bool TypeGenerator::_generateDefaultValue(
   } else if (astType->isDerivedFrom<Spp::Ast::ArrayType>()) {
     // Generate zeroed out array.
     return typeGenerator->generateDefaultArrayValue(static_cast<Ast::ArrayType*>(astType), g, session, result);
+  } else if (astType->isDerivedFrom<Spp::Ast::VectorType>()) {
+    // Generate zeroed out vector.
+    return typeGenerator->generateDefaultVectorValue(static_cast<Ast::VectorType*>(astType), g, session, result);
   } else if (astType->isDerivedFrom<Spp::Ast::UserType>()) {
     // Generate zeroed out structure.
     return typeGenerator->generateDefaultUserTypeValue(static_cast<Ast::UserType*>(astType), g, session, result);
@@ -865,6 +892,31 @@ Bool TypeGenerator::_generateDefaultArrayValue(
 }
 
 
+Bool TypeGenerator::_generateDefaultVectorValue(
+  TiObject *self, Spp::Ast::VectorType *astType, Generation *g, Session *session, TioSharedPtr &result
+) {
+  PREPARE_SELF(typeGenerator, TypeGenerator);
+
+  auto tgType = session->getEda()->tryGetCodeGenData<TiObject>(astType);
+  if (tgType == 0) {
+    if (!typeGenerator->generateType(astType, g, session)) return false;
+    tgType = session->getEda()->getCodeGenData<TiObject>(astType);
+  }
+
+  TioSharedPtr elementVal;
+  auto elementAstType = astType->getContentType(typeGenerator->astHelper);
+  if (!typeGenerator->generateDefaultValue(elementAstType, g, session, elementVal)) return false;
+
+  auto size = astType->getSize(typeGenerator->astHelper);
+  SharedList<TiObject> memberVals;
+  for (Word i = 0; i < size; ++i) {
+    memberVals.add(elementVal);
+  }
+
+  return session->getTg()->generateVectorLiteral(session->getTgContext(), tgType, &memberVals, result);
+}
+
+
 Bool TypeGenerator::_generateDefaultUserTypeValue(
   TiObject *self, Spp::Ast::UserType *astType, Generation *g, Session *session, TioSharedPtr &result
 ) {
@@ -145,6 +145,11 @@ class TypeGenerator : public TiObject, public DynamicBinding, public DynamicInte
     TiObject *self, Spp::Ast::ArrayType *astType, Generation *g, Session *session
   );
 
+  public: METHOD_BINDING_CACHE(generateVectorType, Bool, (Spp::Ast::VectorType*, Generation*, Session*));
+  private: static Bool _generateVectorType(
+    TiObject *self, Spp::Ast::VectorType *astType, Generation *g, Session *session
+  );
+
   public: METHOD_BINDING_CACHE(generateUserType, Bool, (Spp::Ast::UserType*, Generation*, Session*));
   private: static Bool _generateUserType(
     TiObject *self, Spp::Ast::UserType *astType, Generation *g, Session *session
@@ -200,6 +205,13 @@ class TypeGenerator : public TiObject, public DynamicBinding, public DynamicInte
     TiObject *self, Spp::Ast::ArrayType *astType, Generation *g, Session *session, TioSharedPtr &result
   );
 
+  public: METHOD_BINDING_CACHE(generateDefaultVectorValue,
+    Bool, (Spp::Ast::VectorType*, Generation*, Session*, TioSharedPtr&)
+  );
+  private: static Bool _generateDefaultVectorValue(
+    TiObject *self, Spp::Ast::VectorType *astType, Generation *g, Session *session, TioSharedPtr &result
+  );
+
   public: METHOD_BINDING_CACHE(generateDefaultUserTypeValue,
     Bool, (Spp::Ast::UserType*, Generation*, Session*, TioSharedPtr&)
   );
@@ -36,34 +36,40 @@ struct GenResult
 
 s_enum(TerminalStatement, UNKNOWN, NO, YES);
 
+s_enum(AtomicOrdering, RELAXED, ACQUIRE, RELEASE, ACQ_REL, SEQ_CST);
+
+s_enum(AtomicRmwOp, XCHG, ADD, SUB, AND, OR, XOR);
+
 
 //==============================================================================
 // Global Functions
 
+// The key of an extra is either its name or a slot obtained from Core::Data::Ast::getExtraSlot.
+
 // tryGetExtra
 
-template <class DT, class OT,
+template <class DT, class OT, class KT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline DT* tryGetExtra(OT *object, Char const *name)
+inline DT* tryGetExtra(OT *object, KT key)
 {
-  return object->getExtra(name).template ti_cast_get<DT>();
+  return object->getExtra(key).template ti_cast_get<DT>();
 }
 
-template <class DT, class OT,
+template <class DT, class OT, class KT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline DT* tryGetExtra(OT *object, Char const *name)
+inline DT* tryGetExtra(OT *object, KT key)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) return 0;
-  return metadata->getExtra(name).template ti_cast_get<DT>();
+  return metadata->getExtra(key).template ti_cast_get<DT>();
 }
 
 // getExtra
 
-template <class DT, class OT>
-inline DT* getExtra(OT *object, Char const *name)
+template <class DT, class OT, class KT>
+inline DT* getExtra(OT *object, KT key)
 {
-  auto result = tryGetExtra<DT, OT>(object, name);
+  auto result = tryGetExtra<DT, OT, KT>(object, key);
   if (result == 0) {
     throw EXCEPTION(GenericException, S("Object is missing the generated data."));
   }
@@ -72,42 +78,42 @@ inline DT* getExtra(OT *object, Char const *name)
 
 // setExtra
 
-template <class DT, class OT,
+template <class DT, class OT, class KT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void setExtra(OT *object, Char const *name, SharedPtr<DT> const &data)
+inline void setExtra(OT *object, KT key, SharedPtr<DT> const &data)
 {
-  object->setExtra(name, data);
+  object->setExtra(key, data);
 }
 
-template <class DT, class OT,
+template <class DT, class OT, class KT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void setExtra(OT *object, Char const *name, SharedPtr<DT> const &data)
+inline void setExtra(OT *object, KT key, SharedPtr<DT> const &data)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->setExtra(name, data);
+  metadata->setExtra(key, data);
 }
 
 // removeExtra
 
-template <class OT,
+template <class OT, class KT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void removeExtra(OT *object, Char const *name)
+inline void removeExtra(OT *object, KT key)
 {
-  object->removeExtra(name);
+  object->removeExtra(key);
 }
 
-template <class OT,
+template <class OT, class KT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void removeExtra(OT *object, Char const *name)
+inline void removeExtra(OT *object, KT key)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->removeExtra(name);
+  metadata->removeExtra(key);
 }
 
 // Ast Related Accessors
@@ -124,6 +130,26 @@ inline void removeExtra(OT *object, Char const *name)
 DEFINE_FLAG_ACCESSORS(AstProcessed);
 DEFINE_FLAG_ACCESSORS(Executed);
 
+// Atomic Operations
+
+/// Get the memory ordering named by the given identifier, defaulting to sequential consistency if no node is given.
+inline Bool parseAtomicOrdering(TiObject *astNode, AtomicOrdering &order)
+{
+  if (astNode == 0) {
+    order = AtomicOrdering::SEQ_CST;
+    return true;
+  }
+  auto identifier = ti_cast<Core::Data::Ast::Identifier>(astNode);
+  if (identifier == 0) return false;
+  if (identifier->getValue() == S("relaxed")) order = AtomicOrdering::RELAXED;
+  else if (identifier->getValue() == S("acquire")) order = AtomicOrdering::ACQUIRE;
+  else if (identifier->getValue() == S("release")) order = AtomicOrdering::RELEASE;
+  else if (identifier->getValue() == S("acq_rel")) order = AtomicOrdering::ACQ_REL;
+  else if (identifier->getValue() == S("seq_cst")) order = AtomicOrdering::SEQ_CST;
+  else return false;
+  return true;
+}
+
 } // namespace
 
 
@@ -132,6 +158,8 @@ DEFINE_FLAG_ACCESSORS(Executed);
 
 DEFINE_TYPE_NAME(Spp::CodeGen::GenResult, "alusus.org/Spp/Spp.CodeGen.GenResult");
 DEFINE_TYPE_NAME(Spp::CodeGen::TerminalStatement, "alusus.org/Spp/Spp.CodeGen.TerminalStatement");
+DEFINE_TYPE_NAME(Spp::CodeGen::AtomicOrdering, "alusus.org/Spp/Spp.CodeGen.AtomicOrdering");
+DEFINE_TYPE_NAME(Spp::CodeGen::AtomicRmwOp, "alusus.org/Spp/Spp.CodeGen.AtomicRmwOp");
 
 
 //==============================================================================
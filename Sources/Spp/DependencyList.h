@@ -16,12 +16,22 @@
 namespace Spp
 {
 
-template<class CTYPE> class DependencyList : public PlainList<CTYPE>
+/**
+ * @brief A FIFO queue of items that are pending to be built.
+ * @ingroup spp
+ *
+ * Adding an item that is already pending has no effect. Membership is checked
+ * through a hash set and items are consumed from the front by advancing a read
+ * index, so both adding and consuming items take constant time.
+ */
+template<class CTYPE> class DependencyList
 {
   //============================================================================
-  // Constructor & Destructor
+  // Member Variables
 
-  public: using PlainList<CTYPE>::PlainList;
+  private: std::vector<CTYPE*> items;
+  private: Word head = 0;
+  private: std::unordered_set<CTYPE*> pending;
 
 
   //============================================================================
@@ -29,8 +39,31 @@ template<class CTYPE> class DependencyList : public PlainList<CTYPE>
 
   public: void add(CTYPE *f)
   {
-    for (Int i = 0; i < this->getCount(); ++i) if (this->get(i) == f) return;
-    PlainList<CTYPE>::add(f);
+    if (this->pending.insert(f).second) this->items.push_back(f);
+  }
+
+  /// Get the number of pending items.
+  public: Word getCount() const
+  {
+    return this->items.size() - this->head;
+  }
+
+  /// Get the pending item at the given index, with 0 being the front of the queue.
+  public: CTYPE* get(Word index) const
+  {
+    return this->items[this->head + index];
+  }
+
+  /// Remove the item at the front of the queue and return it.
+  public: CTYPE* pop()
+  {
+    auto item = this->items[this->head++];
+    this->pending.erase(item);
+    if (this->head == this->items.size()) {
+      this->items.clear();
+      this->head = 0;
+    }
+    return item;
   }
 
 }; // class
@@ -60,7 +60,9 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     S("integer"), S("صحيح"),
     S("string"), S("محارف"),
     S("any"), S("أيما"),
-    S("next_arg"), S("المعطى_التالي")
+    S("next_arg"), S("المعطى_التالي"),
+    S("atomic"), S("ذري"),
+    S("atomic_fence"), S("حاجز_ذري")
   });
 
   // Add translations for def modifiers.
@@ -204,6 +206,28 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     state->setData(breakStatement);
   }));
 
+  //// atomic_fence = "atomic_fence" + Parameter
+  this->createCommand(S("root.Main.AtomicFence"), {{
+    Map::create({}, { { S("atomic_fence"), 0 }, { S("حاجز_ذري"), 0 } }),
+    {{
+      PARSE_REF(S("module.Subject.Parameter")),
+      TiInt::create(0),
+      TiInt::create(1),
+      TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+    }}
+  }}, newSrdObj<CustomParsingHandler>([](Parser *parser, ParserState *state) {
+    auto metadata = state->getData().ti_cast_get<Data::Ast::MetaHaving>();
+    auto currentList = state->getData().ti_cast_get<Containing<TiObject>>();
+    auto fenceStatement = Ast::AtomicFenceStatement::create({
+      { "prodId", metadata->getProdId() },
+      { "sourceLocation", metadata->findSourceLocation() }
+    });
+    if (currentList != 0) {
+      fenceStatement->setOperand(getSharedPtr(currentList->getElement(1)));
+    }
+    state->setData(fenceStatement);
+  }));
+
   //// return = "return" + Expression
   this->createCommand(S("root.Main.Return"), {{
     Map::create({}, { { S("return"), 0 }, { S("أرجع"), 0 }, { S("ارجع"), 0 } }),
@@ -334,7 +358,8 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     {S("تصدير"), TiStr::create(S("expname"))},
     {S("مشترك"), TiStr::create(S("shared"))},
     {S("دون_ربط"), TiStr::create(S("no_bind"))},
-    {S("عملية"), TiStr::create(S("operation"))}
+    {S("عملية"), TiStr::create(S("operation"))},
+    {S("ضمني"), TiStr::create(S("intrinsic"))}
   }));
 
   // FuncSigExpression
@@ -710,6 +735,18 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
       }
     }
   }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::NextArgOp>::create());
+  // ~atomic
+  this->createCommand(S("root.Main.AtomicTilde"), {{
+    Map::create({}, {{S("atomic"), 0}, {S("ذري"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::AtomicOp>::create());
 
   // Add command references.
 
@@ -720,6 +757,7 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     PARSE_REF(S("module.Continue")),
     PARSE_REF(S("module.Break")),
     PARSE_REF(S("module.Return")),
+    PARSE_REF(S("module.AtomicFence")),
     PARSE_REF(S("module.TypeOp"))
   });
 
@@ -734,7 +772,8 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     PARSE_REF(S("module.PointerTilde")),
     PARSE_REF(S("module.InitTilde")),
     PARSE_REF(S("module.TerminateTilde")),
-    PARSE_REF(S("module.NextArgTilde"))
+    PARSE_REF(S("module.NextArgTilde")),
+    PARSE_REF(S("module.AtomicTilde"))
   });
 
   this->addProdsToGroup(S("root.Main.SubjectCmdGrp"), {
@@ -788,7 +827,9 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
     S("integer"), S("صحيح"),
     S("string"), S("محارف"),
     S("any"), S("أيما"),
-    S("next_arg"), S("المعطى_التالي")
+    S("next_arg"), S("المعطى_التالي"),
+    S("atomic"), S("ذري"),
+    S("atomic_fence"), S("حاجز_ذري")
   });
 
   // Add translation for static modifier.
@@ -809,7 +850,8 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
     S("module.PointerTilde"),
     S("module.InitTilde"),
     S("module.TerminateTilde"),
-    S("module.NextArgTilde")
+    S("module.NextArgTilde"),
+    S("module.AtomicTilde")
   });
 
   // Remove commands from leading commands list.
@@ -820,6 +862,7 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
     S("module.Continue"),
     S("module.Break"),
     S("module.Return"),
+    S("module.AtomicFence"),
     S("module.TypeOp")
   });
 
@@ -850,6 +893,7 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
   this->tryRemove(S("root.Main.TerminateTilde"));
   this->tryRemove(S("root.Main.TerminateTildeSubject"));
   this->tryRemove(S("root.Main.NextArgTilde"));
+  this->tryRemove(S("root.Main.AtomicTilde"));
 
   // Delete leading command definitions.
   this->tryRemove(S("root.Main.If"));
@@ -858,6 +902,7 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
   this->tryRemove(S("root.Main.Continue"));
   this->tryRemove(S("root.Main.Break"));
   this->tryRemove(S("root.Main.Return"));
+  this->tryRemove(S("root.Main.AtomicFence"));
   this->tryRemove(S("root.Main.TypeOp"));
 
   // Delete inner command definitions.
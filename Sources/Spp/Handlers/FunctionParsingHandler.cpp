@@ -188,6 +188,7 @@ Bool FunctionParsingHandler::onIncomingModifier(
   if (!prodProcessingComplete) return false;
 
   if (this->processExpnameModifier(state, modifierData)) return true;
+  else if (this->processIntrinsicModifier(state, modifierData)) return true;
   else if (this->processSharedOrNoBindModifier(state, modifierData)) return true;
   else return this->processUnknownModifier(state, modifierData);
 }
@@ -207,9 +208,39 @@ Bool FunctionParsingHandler::processExpnameModifier(
   auto param = paramPass->getParam().ti_cast_get<Core::Data::Ast::Text>();
   if (param == 0) return false;
 
+  auto function = this->prepareFunction(state);
+  if (function == 0) return false;
+  function->setName(param->getValue());
+
+  return true;
+}
+
+
+Bool FunctionParsingHandler::processIntrinsicModifier(
+  Core::Processing::ParserState *state, TioSharedPtr const &modifierData
+) {
+  // Look for intrinsic modifier.
+  auto paramPass = modifierData.ti_cast_get<Core::Data::Ast::ParamPass>();
+  if (paramPass == 0) return false;
+  if (paramPass->getType() != Core::Data::Ast::BracketType::SQUARE) return false;
+  auto operand = paramPass->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
+  if (operand == 0) return false;
+  auto symbolDef = state->refTopProdLevel().getProd();
+  if (symbolDef->getTranslatedModifierKeyword(operand->getValue().get()) != S("intrinsic")) return false;
+  if (paramPass->getParam().ti_cast_get<Core::Data::Ast::StringLiteral>() == 0) return false;
+
+  // Intrinsics have no body, so we need to make sure the declaration is a function rather than a function type,
+  // then we keep the modifier on the definition for the code generator to find.
+  if (this->prepareFunction(state) == 0) return false;
+  return this->processUnknownModifier(state, modifierData);
+}
+
+
+Spp::Ast::Function* FunctionParsingHandler::prepareFunction(Core::Processing::ParserState *state)
+{
   Int levelOffset = -state->getTopProdTermLevelCount();
   TioSharedPtr data = state->getData(levelOffset);
-  if (data == 0) return false;
+  if (data == 0) return 0;
 
   // Grab the data from the definition, if any, otherwise use the data from the state level.
   Core::Data::Ast::Definition *definition = 0;
@@ -218,28 +249,22 @@ Bool FunctionParsingHandler::processExpnameModifier(
     data = definition->getTarget();
   }
   Spp::Ast::Function *function = data.ti_cast_get<Spp::Ast::Function>();
-
-  // Set the function name.
-  if (function == 0) {
-    // The data isn't a function, so it must be a FunctionType.
-    auto functionType = ti_cast<Spp::Ast::FunctionType>(data);
-    ASSERT(functionType != 0);
-    auto newFunction = newSrdObj<Spp::Ast::Function>();
-    newFunction->setType(functionType);
-    newFunction->setSourceLocation(functionType->findSourceLocation());
-    newFunction->setProdId(functionType->getProdId());
-    newFunction->setName(param->getValue());
-    // If a definition exists, update its target with the new function, otherwise set the new function to the state.
-    if (definition != 0) {
-      definition->setTarget(newFunction);
-    } else {
-      state->setData(newFunction, levelOffset);
-    }
+  if (function != 0) return function;
+
+  // The data isn't a function, so it must be a FunctionType.
+  auto functionType = ti_cast<Spp::Ast::FunctionType>(data);
+  ASSERT(functionType != 0);
+  auto newFunction = newSrdObj<Spp::Ast::Function>();
+  newFunction->setType(functionType);
+  newFunction->setSourceLocation(functionType->findSourceLocation());
+  newFunction->setProdId(functionType->getProdId());
+  // If a definition exists, update its target with the new function, otherwise set the new function to the state.
+  if (definition != 0) {
+    definition->setTarget(newFunction);
   } else {
-    function->setName(param->getValue());
+    state->setData(newFunction, levelOffset);
   }
-
-  return true;
+  return newFunction.get();
 }
 
 
@@ -263,7 +288,9 @@ Bool FunctionParsingHandler::processSharedOrNoBindModifier(
   if (state->getData(levelOffset)->isDerivedFrom<Core::Data::Ast::Definition>()) {
     auto definition = state->getData(levelOffset).s_cast_get<Core::Data::Ast::Definition>();
     auto function = definition->getTarget().ti_cast_get<Spp::Ast::Function>();
-    funcType = function->getType().get();
+    if (function != 0) funcType = function->getType().get();
+    else funcType = definition->getTarget().ti_cast_get<Spp::Ast::FunctionType>();
+    if (funcType == 0) throw EXCEPTION(GenericException, S("Unexpected data type found."));
   } else if (state->getData(levelOffset)->isDerivedFrom<Spp::Ast::Function>()) {
     auto function = state->getData(levelOffset).s_cast_get<Spp::Ast::Function>();
     funcType = function->getType().get();
@@ -54,6 +54,13 @@ class FunctionParsingHandler : public Core::Processing::Handlers::GenericParsing
     Core::Processing::ParserState *state, TioSharedPtr const &modifierData
   );
 
+  private: Bool processIntrinsicModifier(
+    Core::Processing::ParserState *state, TioSharedPtr const &modifierData
+  );
+
+  /// Make sure the function being parsed is a Function rather than a bodiless FunctionType.
+  private: Spp::Ast::Function* prepareFunction(Core::Processing::ParserState *state);
+
   private: Bool processSharedOrNoBindModifier(
     Core::Processing::ParserState *state, TioSharedPtr const &modifierData
   );
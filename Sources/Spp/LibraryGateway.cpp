@@ -233,6 +233,17 @@ void LibraryGateway::createBuiltInTypes(Core::Main::RootManager *manager)
   tmplt->setBody(Ast::ArrayType::create());
   identifier.setValue(S("array"));
   manager->getSeeker()->doSet(&identifier, root, tmplt.get());
+
+  // vector
+  auto defaultVectorSize = Core::Data::Ast::IntegerLiteral::create({{ S("value"), TiStr(S("4")) }});
+  tmplt = Ast::Template::create();
+  tmplt->setVarDefs(Core::Data::Ast::List::create({}, {
+    newSrdObj<Ast::TemplateVarDef>(S("type"), Ast::TemplateVarType::TYPE),
+    newSrdObj<Ast::TemplateVarDef>(S("size"), Ast::TemplateVarType::INTEGER, defaultVectorSize)
+  }));
+  tmplt->setBody(Ast::VectorType::create());
+  identifier.setValue(S("vector"));
+  manager->getSeeker()->doSet(&identifier, root, tmplt.get());
 }
 
 
@@ -273,6 +284,9 @@ void LibraryGateway::removeBuiltInTypes(Core::Main::RootManager *manager)
 
   identifier.setValue(S("array"));
   manager->getSeeker()->tryRemove(&identifier, root);
+
+  identifier.setValue(S("vector"));
+  manager->getSeeker()->tryRemove(&identifier, root);
 }
 
 
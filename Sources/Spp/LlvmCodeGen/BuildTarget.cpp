@@ -15,6 +15,38 @@
 namespace Spp::LlvmCodeGen
 {
 
+Word BuildTarget::getDefaultCompileThreadCount()
+{
+  Char const *threadsEnv = getenv(S("ALUSUS_JIT_THREADS"));
+  if (threadsEnv != 0 && threadsEnv[0] != C('\0')) {
+    // Malformed or negative counts are ignored in favor of the default.
+    Char *end;
+    errno = 0;
+    auto count = strtol(threadsEnv, &end, 10);
+    if (errno == 0 && *end == C('\0') && count >= 0) return count;
+  }
+  // Compile threads are opt-in since they only pay off for programs with many modules.
+  return 0;
+}
+
+
+llvm::orc::ThreadSafeModule BuildTarget::makeJitModule(
+  std::unique_ptr<llvm::Module> module, llvm::orc::ThreadSafeContext const &sharedContext, Word compileThreadCount
+) {
+  if (compileThreadCount == 0) return llvm::orc::ThreadSafeModule(std::move(module), sharedContext);
+
+  llvm::SmallVector<char, 0> buffer;
+  llvm::raw_svector_ostream stream(buffer);
+  llvm::WriteBitcodeToFile(*module, stream);
+  auto context = std::make_unique<llvm::LLVMContext>();
+  // The module identifier carries the object cache key, so it's kept as the identifier of the new module.
+  auto ownModule = llvm::cantFail(llvm::parseBitcodeFile(
+    llvm::MemoryBufferRef(llvm::StringRef(buffer.data(), buffer.size()), module->getModuleIdentifier()), *context
+  ));
+  return llvm::orc::ThreadSafeModule(std::move(ownModule), std::move(context));
+}
+
+
 llvm::Type* BuildTarget::getVaListType()
 {
   if (this->vaListType == 0) {
@@ -50,8 +50,36 @@ class BuildTarget : public TiObject
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module) = 0;
 
+  /// Add a module of functions that are only executed once.
+  public: virtual void addOneShotLlvmModule(std::unique_ptr<llvm::Module> module)
+  {
+    this->addLlvmModule(std::move(module));
+  }
+
   public: virtual llvm::Type* getVaListType();
 
+  /**
+   * @brief Get the default number of threads used to compile JIT modules.
+   *
+   * Taken from the ALUSUS_JIT_THREADS environment variable if set, otherwise
+   * defaults to 0, which means compiling on the executing thread. Values that
+   * aren't non-negative integers are ignored.
+   */
+  public: static Word getDefaultCompileThreadCount();
+
+  /**
+   * @brief Wrap a module to be added to a JIT engine.
+   *
+   * ORC locks a context while compiling any of its modules, so modules that
+   * share a context are compiled one at a time. When compile threads are
+   * used the module is moved into its own context, by writing it as bitcode
+   * and reading it back, so that the threads can compile modules in
+   * parallel. Otherwise the module keeps the shared context.
+   */
+  protected: static llvm::orc::ThreadSafeModule makeJitModule(
+    std::unique_ptr<llvm::Module> module, llvm::orc::ThreadSafeContext const &sharedContext, Word compileThreadCount
+  );
+
 }; // class
 
 } // namespace
@@ -35,6 +35,9 @@ class Function : public TiObject
   private: llvm::AllocaInst *llvmVaList = 0;
   private: std::unique_ptr<llvm::Module> llvmModule;
 
+  /// Whether the function is only executed once, like root scope statements.
+  private: Bool oneShot = false;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -79,6 +82,15 @@ class Function : public TiObject
     return this->llvmFunction;
   }
 
+  public: void setOneShot(Bool os)
+  {
+    this->oneShot = os;
+  }
+  public: Bool isOneShot() const
+  {
+    return this->oneShot;
+  }
+
 }; // class
 
 } // namespace
@@ -20,8 +20,13 @@ void JitBuildTarget::setupBuild()
   BuildTarget::setupBuild();
 
   this->llvmJitEngine.reset();
+  this->objectCache = JitObjectCache::create(JitEngineBuilderState::getCodeGenOptLevel(this->optLevel));
 
-  this->llvmJitEngine = llvm::cantFail(JitEngineBuilder().create(this->globalItemRepo));
+  this->llvmJitEngine = llvm::cantFail(JitEngineBuilder()
+    .setOptLevel(this->optLevel)
+    .setNumCompileThreads(this->compileThreadCount)
+    .setObjectCache(this->objectCache.get())
+    .create(this->globalItemRepo));
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
 
   this->llvmModule.reset();
@@ -48,6 +53,12 @@ llvm::Module* JitBuildTarget::getGlobalLlvmModule()
 
 
 void JitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
+{
+  this->addLlvmModule(std::move(module), true);
+}
+
+
+void JitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module, Bool optimize)
 {
   #ifdef USE_LOGS
     if (Core::Basic::Logger::getFilter() & Spp::LogLevel::LLVMCODEGEN_IR) {
@@ -61,13 +72,15 @@ void JitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
 
   // Compile the module.
   this->llvmJitEngine->addIRModule(
-    llvm::orc::ThreadSafeModule(std::move(module), *this->llvmTsContext)
+    BuildTarget::makeJitModule(std::move(module), *this->llvmTsContext, this->compileThreadCount), optimize
   );
 }
 
 
 void JitBuildTarget::execute(Char const *entry)
 {
+  // The global module can hold function bodies when functions aren't built into their own modules, so it's
+  // optimized like any other module.
   if (this->llvmModule != 0) this->addLlvmModule(std::move(this->llvmModule));
 
   typedef void (*FuncType)();
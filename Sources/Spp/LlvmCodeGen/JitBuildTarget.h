@@ -27,6 +27,7 @@ class JitBuildTarget : public BuildTarget
   //============================================================================
   // Member Variables
 
+  private: std::unique_ptr<JitObjectCache> objectCache;
   private: std::unique_ptr<JitEngine> llvmJitEngine;
   private: std::unique_ptr<llvm::orc::ThreadSafeContext> llvmTsContext;
   private: llvm::LLVMContext *llvmContext = 0;
@@ -35,17 +36,25 @@ class JitBuildTarget : public BuildTarget
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
 
+  /// The number of threads used to compile modules; 0 to compile on the executing thread.
+  private: Word compileThreadCount;
+
+  /// The optimization level of the generated code, from 0 to 3.
+  private: Word optLevel = 3;
+
 
   //============================================================================
   // Constructors & Destructor
 
-  public: JitBuildTarget(CodeGen::GlobalItemRepo *gir) : globalItemRepo(gir)
+  public: JitBuildTarget(CodeGen::GlobalItemRepo *gir) :
+    globalItemRepo(gir), compileThreadCount(BuildTarget::getDefaultCompileThreadCount())
   {
   }
 
   public: virtual ~JitBuildTarget()
   {
     this->llvmJitEngine.reset();
+    this->objectCache.reset();
     this->llvmModule.reset();
     this->llvmTsContext.reset();
   }
@@ -54,6 +63,32 @@ class JitBuildTarget : public BuildTarget
   //============================================================================
   // Member Functions
 
+  public: void setOptLevel(Word level)
+  {
+    if (level > 3) {
+      throw EXCEPTION(InvalidArgumentException, S("level"), S("Optimization level must be between 0 and 3."), level);
+    }
+    this->optLevel = level;
+    // The code generation level is only applied when the engine is recreated in the next setupBuild.
+    if (this->llvmJitEngine != 0) this->llvmJitEngine->setOptLevel(level);
+  }
+
+  public: Word getOptLevel() const
+  {
+    return this->optLevel;
+  }
+
+  /// Set the number of compile threads. Applied when the engine is recreated in the next setupBuild.
+  public: void setCompileThreadCount(Word count)
+  {
+    this->compileThreadCount = count;
+  }
+
+  public: Word getCompileThreadCount() const
+  {
+    return this->compileThreadCount;
+  }
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -75,6 +110,14 @@ class JitBuildTarget : public BuildTarget
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module);
 
+  /// One shot modules are compiled without IR optimizations.
+  public: virtual void addOneShotLlvmModule(std::unique_ptr<llvm::Module> module)
+  {
+    this->addLlvmModule(std::move(module), false);
+  }
+
+  private: void addLlvmModule(std::unique_ptr<llvm::Module> module, Bool optimize);
+
   public: void execute(Char const *entry);
 
 }; // class
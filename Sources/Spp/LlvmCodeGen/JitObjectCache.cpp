@@ -0,0 +1,261 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+#include <algorithm>
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief The prefix of module identifiers that carry a cache key.
+ *
+ * Tagged identifiers have the form <prefix>O<opt level>:<key>.
+ */
+static Char const *keyTagPrefix = "alusus-jit-cache:O";
+
+
+//==============================================================================
+// Constructor & Destructor
+
+JitObjectCache::JitObjectCache(std::string const &dir, std::string const &ck, LongWord ms) :
+  directory(dir), configKey(ck), maxSize(ms), writtenSize(0)
+{
+  if (!this->directory.empty() && this->directory.back() != C('/')) this->directory += C('/');
+  llvm::sys::fs::create_directories(this->directory);
+}
+
+
+JitObjectCache::~JitObjectCache()
+{
+  if (this->writtenSize > 0) this->evict();
+}
+
+
+std::unique_ptr<JitObjectCache> JitObjectCache::create(llvm::CodeGenOpt::Level codeGenOptLevel)
+{
+  Char const *enabledEnv = getenv(S("ALUSUS_JIT_CACHE"));
+  if (enabledEnv == 0 || compareStr(enabledEnv, S("1")) != 0) return std::unique_ptr<JitObjectCache>();
+
+  std::string dir;
+  Char const *dirEnv = getenv(S("ALUSUS_JIT_CACHE_DIR"));
+  if (dirEnv != 0 && *dirEnv != C('\0')) {
+    dir = dirEnv;
+  } else {
+    Char const *cacheHome = getenv(S("XDG_CACHE_HOME"));
+    if (cacheHome != 0 && *cacheHome != C('\0')) {
+      dir = std::string(cacheHome) + S("/alusus/jit_cache/");
+    } else {
+      Char const *home = getenv(S("HOME"));
+      if (home != 0 && *home != C('\0')) {
+        dir = std::string(home) + S("/.cache/alusus/jit_cache/");
+      } else {
+        // We don't know where to keep the cache.
+        return std::unique_ptr<JitObjectCache>();
+      }
+    }
+  }
+
+  LongWord maxSize = 256;
+  Char const *sizeEnv = getenv(S("ALUSUS_JIT_CACHE_SIZE"));
+  if (sizeEnv != 0 && *sizeEnv != C('\0')) {
+    // Malformed sizes are ignored in favor of the default.
+    Char *end;
+    errno = 0;
+    auto size = strtoul(sizeEnv, &end, 10);
+    if (errno == 0 && *end == C('\0') && sizeEnv[0] != C('-')) maxSize = size;
+  }
+  maxSize *= 1024 * 1024;
+
+  // Objects can only be reused by a JIT with the same target and code generation options.
+  std::string configKey = llvm::sys::getProcessTriple();
+  configKey += C(';');
+  configKey += llvm::sys::getHostCPUName().str();
+  llvm::StringMap<bool> hostFeatures;
+  if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+    std::vector<std::string> features;
+    for (auto &feature : hostFeatures) {
+      features.push_back((feature.second ? S("+") : S("-")) + feature.first().str());
+    }
+    std::sort(features.begin(), features.end());
+    for (auto &feature : features) configKey += feature;
+  }
+  configKey += C(';');
+  configKey += std::to_string(static_cast<Int>(codeGenOptLevel));
+  configKey += C(';');
+  configKey += LLVM_VERSION_STRING;
+
+  return std::make_unique<JitObjectCache>(dir, configKey, maxSize);
+}
+
+
+//==============================================================================
+// Member Functions
+
+Bool JitObjectCache::tagModule(llvm::Module &module, Word optLevel)
+{
+  auto key = this->computeKey(&module, optLevel);
+  module.setModuleIdentifier(std::string(keyTagPrefix) + std::to_string(optLevel) + C(':') + key);
+  auto buffer = llvm::MemoryBuffer::getFile(this->getFilename(key), -1, false);
+  if (!buffer) return false;
+  std::lock_guard<std::mutex> lock(this->pendingObjectsMutex);
+  this->pendingObjects[key] = std::move(*buffer);
+  return true;
+}
+
+
+Int JitObjectCache::getTaggedOptLevel(llvm::Module const &module)
+{
+  auto &id = module.getModuleIdentifier();
+  auto prefixLength = getStrLen(keyTagPrefix);
+  if (id.compare(0, prefixLength, keyTagPrefix) != 0) return -1;
+  return atoi(id.c_str() + prefixLength);
+}
+
+
+void JitObjectCache::notifyObjectCompiled(llvm::Module const *module, llvm::MemoryBufferRef obj)
+{
+  // The IR has already been changed by code generation at this point, so untagged modules can't be keyed.
+  auto key = JitObjectCache::getKey(module);
+  if (key.empty()) return;
+  auto filename = this->getFilename(key);
+
+  // Write into a temp file then rename it to avoid leaving incomplete entries behind, or exposing incomplete entries
+  // to other threads or processes.
+  llvm::SmallString<128> tempFilename;
+  Int fd;
+  if (llvm::sys::fs::createUniqueFile(filename + ".%%%%%%.tmp", fd, tempFilename)) return;
+  {
+    llvm::raw_fd_ostream stream(fd, true);
+    stream << obj.getBuffer();
+    stream.close();
+    if (stream.has_error()) {
+      stream.clear_error();
+      llvm::sys::fs::remove(tempFilename);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(tempFilename, filename)) {
+    llvm::sys::fs::remove(tempFilename);
+    return;
+  }
+
+  // Keep the cache bounded during long sessions rather than only when the cache is destroyed.
+  if ((this->writtenSize += obj.getBufferSize()) > this->maxSize / 8) {
+    std::unique_lock<std::mutex> lock(this->evictionMutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+      this->writtenSize = 0;
+      this->evictUnlocked();
+    }
+  }
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::getObject(llvm::Module const *module)
+{
+  auto key = JitObjectCache::getKey(module);
+  if (key.empty()) return std::unique_ptr<llvm::MemoryBuffer>();
+  {
+    std::lock_guard<std::mutex> lock(this->pendingObjectsMutex);
+    auto iter = this->pendingObjects.find(key);
+    if (iter != this->pendingObjects.end()) {
+      auto buffer = std::move(iter->second);
+      this->pendingObjects.erase(iter);
+      return buffer;
+    }
+  }
+
+  auto filename = this->getFilename(key);
+  auto buffer = llvm::MemoryBuffer::getFile(filename, -1, false);
+  if (!buffer) return std::unique_ptr<llvm::MemoryBuffer>();
+
+  // Update the modification time to keep recently used objects from being evicted.
+  Int fd;
+  if (!llvm::sys::fs::openFileForWrite(filename, fd, llvm::sys::fs::CD_OpenExisting, llvm::sys::fs::OF_Append)) {
+    llvm::sys::fs::setLastAccessAndModificationTime(
+      fd, std::chrono::time_point_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now())
+    );
+    llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  }
+
+  return std::move(*buffer);
+}
+
+
+void JitObjectCache::evict()
+{
+  std::lock_guard<std::mutex> lock(this->evictionMutex);
+  this->writtenSize = 0;
+  this->evictUnlocked();
+}
+
+
+void JitObjectCache::evictUnlocked()
+{
+  struct Entry
+  {
+    std::string path;
+    LongWord size;
+    llvm::sys::TimePoint<> time;
+  };
+
+  std::vector<Entry> entries;
+  LongWord totalSize = 0;
+  std::error_code ec;
+  for (
+    llvm::sys::fs::directory_iterator iter(this->directory, ec), end;
+    iter != end && !ec;
+    iter.increment(ec)
+  ) {
+    if (llvm::sys::path::extension(iter->path()) != ".o") continue;
+    llvm::sys::fs::file_status status;
+    if (llvm::sys::fs::status(iter->path(), status)) continue;
+    entries.push_back({ iter->path(), status.getSize(), status.getLastModificationTime() });
+    totalSize += status.getSize();
+  }
+  if (totalSize <= this->maxSize) return;
+
+  std::sort(entries.begin(), entries.end(), [](Entry const &e1, Entry const &e2)->Bool {
+    return e1.time < e2.time;
+  });
+  for (auto &entry : entries) {
+    if (totalSize <= this->maxSize) break;
+    if (!llvm::sys::fs::remove(entry.path)) totalSize -= entry.size;
+  }
+}
+
+
+std::string JitObjectCache::hashModule(llvm::Module const *module, std::string const &config)
+{
+  // The config is terminated with a null char so it can't run into the IR.
+  std::string data = config;
+  data += C('\0');
+  llvm::raw_string_ostream stream(data);
+  module->print(stream, nullptr);
+  stream.flush();
+
+  auto hash = llvm::SHA1::hash(llvm::ArrayRef<uint8_t>(reinterpret_cast<uint8_t const*>(data.data()), data.size()));
+  return llvm::toHex(hash, true);
+}
+
+
+std::string JitObjectCache::getKey(llvm::Module const *module)
+{
+  auto &id = module->getModuleIdentifier();
+  auto prefixLength = getStrLen(keyTagPrefix);
+  if (id.compare(0, prefixLength, keyTagPrefix) != 0) return std::string();
+  auto separator = id.find(C(':'), prefixLength);
+  if (separator == std::string::npos) return std::string();
+  return id.substr(separator + 1);
+}
+
+} // namespace
@@ -0,0 +1,145 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.h
+ * Contains the header of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+#define SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief An on-disk cache of the objects compiled by the JIT.
+ * @ingroup spp_llvmcodegen
+ *
+ * Objects are keyed by a SHA-1 hash of the module's IR before optimization,
+ * the IR and code generation optimization levels, and the host's target
+ * triple and CPU, so a module that didn't change between runs is linked from
+ * the cache instead of being optimized and compiled again. The total size of
+ * the cache is bounded; the least recently used objects are evicted whenever
+ * enough new objects have been written since the last eviction.<br>
+ * The cache can be accessed concurrently from the JIT's compile threads.
+ */
+class JitObjectCache : public llvm::ObjectCache
+{
+  //============================================================================
+  // Member Variables
+
+  private: std::string directory;
+
+  /// Identifies the host and code generation options the objects are compiled for.
+  private: std::string configKey;
+
+  private: LongWord maxSize;
+
+  /// The size of the objects written since the last eviction.
+  private: std::atomic<LongWord> writtenSize;
+
+  private: std::mutex evictionMutex;
+
+  /**
+   * @brief Objects loaded for modules whose optimization was skipped.
+   *
+   * Keyed by cache key. These objects are loaded when the module is tagged
+   * rather than when the compile layer asks for them, so evicting the file in
+   * between can't lead to compiling the unoptimized module and storing it
+   * under the key of the optimized one.
+   */
+  private: std::unordered_map<std::string, std::unique_ptr<llvm::MemoryBuffer>> pendingObjects;
+
+  private: std::mutex pendingObjectsMutex;
+
+
+  //============================================================================
+  // Constructor & Destructor
+
+  public: JitObjectCache(std::string const &dir, std::string const &ck, LongWord ms);
+
+  public: virtual ~JitObjectCache();
+
+  /**
+   * @brief Create a cache for the host using the environment's configuration.
+   *
+   * The cache is only used if ALUSUS_JIT_CACHE is set to 1. It's kept in the
+   * directory specified by ALUSUS_JIT_CACHE_DIR if set, otherwise in
+   * alusus/jit_cache/ inside the user's cache directory. The size limit is
+   * taken from ALUSUS_JIT_CACHE_SIZE, in megabytes, and defaults to 256.
+   *
+   * @param codeGenOptLevel The code generation level of the JIT, which is
+   *                        part of the key of all objects.
+   * @return The cache, or null if the cache isn't enabled or if there is no
+   *         known cache directory.
+   */
+  public: static std::unique_ptr<JitObjectCache> create(llvm::CodeGenOpt::Level codeGenOptLevel);
+
+
+  //============================================================================
+  // Member Functions
+
+  /**
+   * @brief Compute the cache key of the given module and attach it to it.
+   *
+   * Called for every module before it's handed to the JIT's layers so that
+   * the key is independent of the optimization passes and of code generation,
+   * both of which modify the IR. The key and the optimization level are stored
+   * in the module's identifier, which is where they are read from when the
+   * module is optimized and when the object is later looked up. Modules that
+   * aren't tagged are never cached.
+   *
+   * @param optLevel The level of IR optimizations the module will be compiled
+   *                 with, or 0 if it won't be optimized.
+   * @return true if the cache has an object for the module, in which case
+   *         optimizing the module can be skipped. The object is loaded right
+   *         away, so it's available to getObject even if the file gets
+   *         evicted in the meantime.
+   */
+  public: Bool tagModule(llvm::Module &module, Word optLevel);
+
+  /**
+   * @brief Get the optimization level the given module was tagged with.
+   * @return The level passed to tagModule, or -1 if the module isn't tagged.
+   */
+  public: static Int getTaggedOptLevel(llvm::Module const &module);
+
+  public: virtual void notifyObjectCompiled(llvm::Module const *module, llvm::MemoryBufferRef obj) override;
+
+  public: virtual std::unique_ptr<llvm::MemoryBuffer> getObject(llvm::Module const *module) override;
+
+  /// Remove the least recently used objects until the cache fits within its size limit.
+  public: void evict();
+
+  /// Same as evict, but requires the caller to hold evictionMutex.
+  private: void evictUnlocked();
+
+  /**
+   * @brief Compute a SHA-1 hash of the module's IR and the given config.
+   * @return The hash as a hexadecimal string.
+   */
+  public: static std::string hashModule(llvm::Module const *module, std::string const &config);
+
+  private: std::string computeKey(llvm::Module const *module, Word optLevel) const
+  {
+    return JitObjectCache::hashModule(module, this->configKey + C(';') + std::to_string(optLevel));
+  }
+
+  /// Get the key of a tagged module, or an empty string if the module isn't tagged.
+  private: static std::string getKey(llvm::Module const *module);
+
+  private: std::string getFilename(std::string const &key) const
+  {
+    return this->directory + key + ".o";
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -21,7 +21,10 @@ void LazyJitBuildTarget::setupBuild()
 
   this->llvmJitEngine.reset();
 
-  this->llvmJitEngine = llvm::cantFail(LazyJitEngineBuilder().create(this->globalItemRepo));
+  this->llvmJitEngine = llvm::cantFail(LazyJitEngineBuilder()
+    .setOptLevel(this->optLevel)
+    .setNumCompileThreads(this->compileThreadCount)
+    .create(this->globalItemRepo));
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
 
   this->llvmModule.reset();
@@ -61,7 +64,7 @@ void LazyJitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
 
   // Compile the module.
   this->llvmJitEngine->addLazyIRModule(
-    llvm::orc::ThreadSafeModule(std::move(module), *this->llvmTsContext)
+    BuildTarget::makeJitModule(std::move(module), *this->llvmTsContext, this->compileThreadCount)
   );
 }
 
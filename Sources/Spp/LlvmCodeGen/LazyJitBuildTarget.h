@@ -35,11 +35,18 @@ class LazyJitBuildTarget : public BuildTarget
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
 
+  /// The number of threads used to compile modules; 0 to compile on the executing thread.
+  private: Word compileThreadCount;
+
+  /// The optimization level of the generated code, from 0 to 3.
+  private: Word optLevel = 0;
+
 
   //============================================================================
   // Constructors & Destructor
 
-  public: LazyJitBuildTarget(CodeGen::GlobalItemRepo *gir) : globalItemRepo(gir)
+  public: LazyJitBuildTarget(CodeGen::GlobalItemRepo *gir) :
+    globalItemRepo(gir), compileThreadCount(BuildTarget::getDefaultCompileThreadCount())
   {
   }
 
@@ -54,6 +61,32 @@ class LazyJitBuildTarget : public BuildTarget
   //============================================================================
   // Member Functions
 
+  public: void setOptLevel(Word level)
+  {
+    if (level > 3) {
+      throw EXCEPTION(InvalidArgumentException, S("level"), S("Optimization level must be between 0 and 3."), level);
+    }
+    this->optLevel = level;
+    // The code generation level is only applied when the engine is recreated in the next setupBuild.
+    if (this->llvmJitEngine != 0) this->llvmJitEngine->setOptLevel(level);
+  }
+
+  public: Word getOptLevel() const
+  {
+    return this->optLevel;
+  }
+
+  /// Set the number of compile threads. Applied when the engine is recreated in the next setupBuild.
+  public: void setCompileThreadCount(Word count)
+  {
+    this->compileThreadCount = count;
+  }
+
+  public: Word getCompileThreadCount() const
+  {
+    return this->compileThreadCount;
+  }
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
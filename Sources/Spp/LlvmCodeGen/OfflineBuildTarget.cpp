@@ -15,11 +15,38 @@
 namespace Spp::LlvmCodeGen
 {
 
+void OfflineBuildTarget::resolveCpu(std::string &resolvedCpu, std::string &resolvedFeatures) const
+{
+  resolvedFeatures = this->cpuFeatures;
+  if (this->cpu != "native") {
+    resolvedCpu = this->cpu;
+    return;
+  }
+
+  // The host's CPU is meaningless when cross compiling.
+  if (llvm::Triple(this->targetTriple) != llvm::Triple(llvm::sys::getDefaultTargetTriple())) {
+    resolvedCpu = "generic";
+    return;
+  }
+
+  resolvedCpu = llvm::sys::getHostCPUName().str();
+  llvm::SubtargetFeatures subtargetFeatures;
+  llvm::StringMap<bool> hostFeatures;
+  if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+    for (auto &feature : hostFeatures) subtargetFeatures.AddFeature(feature.first(), feature.second);
+  }
+  // Explicitly requested features are added last to override the host's features.
+  if (!this->cpuFeatures.empty()) subtargetFeatures.AddFeature(this->cpuFeatures);
+  resolvedFeatures = subtargetFeatures.getString();
+}
+
+
 void OfflineBuildTarget::setupBuild()
 {
   BuildTarget::setupBuild();
 
   this->llvmGlobalCtorDtorEntryTypes = LlvmGlobalCtorDtorEntryTypes();
+  this->partitions.clear();
   this->llvmModule.reset();
 
   std::string error;
@@ -32,12 +59,23 @@ void OfflineBuildTarget::setupBuild()
     throw EXCEPTION(GenericException, error.c_str());
   }
 
-  auto cpu = "generic";
-  auto features = "";
+  std::string cpu;
+  std::string features;
+  this->resolveCpu(cpu, features);
+
+  llvm::CodeGenOpt::Level codeGenOptLevel;
+  switch (this->optLevel) {
+    case 0: codeGenOptLevel = llvm::CodeGenOpt::None; break;
+    case 1: codeGenOptLevel = llvm::CodeGenOpt::Less; break;
+    case 2: codeGenOptLevel = llvm::CodeGenOpt::Default; break;
+    default: codeGenOptLevel = llvm::CodeGenOpt::Aggressive; break;
+  }
 
   llvm::TargetOptions opt;
   auto rm = llvm::Optional<llvm::Reloc::Model>();
-  this->targetMachine = target->createTargetMachine(targetTriple, cpu, features, opt, rm);
+  this->targetMachine = target->createTargetMachine(
+    targetTriple, cpu, features, opt, rm, llvm::None, codeGenOptLevel
+  );
 
   this->llvmDataLayout = std::make_unique<llvm::DataLayout>(this->targetMachine->createDataLayout());
 
@@ -72,9 +110,27 @@ void OfflineBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
     }
   #endif
 
-  // Compile the module.
-  this->llvmModule = std::move(module);
-  this->llvmModule->setDataLayout(*this->llvmDataLayout);
+  if (!this->isIncremental()) {
+    this->linkLlvmModule(std::move(module));
+  } else {
+    module->setDataLayout(*this->llvmDataLayout);
+    this->partitions.push_back(std::move(module));
+  }
+}
+
+
+void OfflineBuildTarget::addOneShotLlvmModule(std::unique_ptr<llvm::Module> module)
+{
+  this->linkLlvmModule(std::move(module));
+}
+
+
+void OfflineBuildTarget::linkLlvmModule(std::unique_ptr<llvm::Module> module)
+{
+  module->setDataLayout(*this->llvmDataLayout);
+  if (llvm::Linker::linkModules(*this->getGlobalLlvmModule(), std::move(module))) {
+    throw EXCEPTION(GenericException, S("Failed to link function module into the program's module."));
+  }
 }
 
 
@@ -90,6 +146,9 @@ Str OfflineBuildTarget::generateLlvmIr(std::vector<Str> const *ctorNames, std::v
   StrStream strStream;
   llvm::raw_os_ostream ostream(strStream);
   llvm::createPrintModulePass(ostream)->runOnModule(*(this->llvmModule));
+  for (auto &partition : this->partitions) {
+    llvm::createPrintModulePass(ostream)->runOnModule(*partition);
+  }
 
   return Str(strStream.str().c_str());
 }
@@ -103,11 +162,106 @@ void OfflineBuildTarget::generateObjectFile(
     throw EXCEPTION(GenericException, S("LLVM module is not generated yet."));
   }
 
+  if (!this->profileUseFilename.empty() && !llvm::sys::fs::exists(this->profileUseFilename)) {
+    throw EXCEPTION(FileException, this->profileUseFilename.c_str(), C('r'));
+  }
+
   this->buildCtorOrDtorArray(ctorNames, "llvm.global_ctors");
   this->buildCtorOrDtorArray(dtorNames, "llvm.global_dtors");
 
   this->llvmModule->setTargetTriple(this->targetTriple);
+  if (this->isIncremental()) this->generatePartitionObjects(filename);
+  if (this->ltoMode == LtoMode::FULL) this->optimizeWholeProgram(this->llvmModule.get());
+  else this->optimizeModule(this->llvmModule.get());
+  this->emitObjectFile(this->llvmModule.get(), filename);
+}
 
+
+void OfflineBuildTarget::generatePartitionObjects(Char const *filename)
+{
+  // Objects can only be reused with the same target and code generation options.
+  std::string config = this->targetTriple;
+  config += C(';');
+  config += this->targetMachine->getTargetCPU().str();
+  config += C(';');
+  config += this->targetMachine->getTargetFeatureString().str();
+  config += C(';');
+  config += std::to_string(this->optLevel);
+  config += C(';');
+  config += std::to_string(this->sizeLevel);
+  config += C(';');
+  config += std::to_string(this->ltoMode);
+  config += C(';');
+  config += this->profileGenerateFilename;
+  config += C(';');
+  if (!this->profileUseFilename.empty()) {
+    // Objects need to be regenerated whenever the profile changes.
+    auto profile = llvm::MemoryBuffer::getFile(this->profileUseFilename, -1, false);
+    if (!profile) throw EXCEPTION(FileException, this->profileUseFilename.c_str(), C('r'));
+    config += std::to_string(
+      Core::Main::ParseCache::computeHash((*profile)->getBufferStart(), (*profile)->getBufferSize())
+    );
+  }
+  config += C(';');
+  config += LLVM_VERSION_STRING;
+
+  // Each target and config gets its own sub directory so that builds for different targets, like executables and
+  // WebAssembly modules, can share the incremental dir without removing each other's objects.
+  auto configHash = llvm::SHA1::hash(
+    llvm::ArrayRef<uint8_t>(reinterpret_cast<uint8_t const*>(config.data()), config.size())
+  );
+  std::string objectsDir = this->incrementalDir;
+  objectsDir += this->targetTriple;
+  objectsDir += C('-');
+  objectsDir += llvm::toHex(configHash, true).substr(0, 16);
+  objectsDir += C('/');
+  llvm::sys::fs::create_directories(objectsDir);
+
+  std::unordered_set<std::string> objectFilenames;
+  std::string responseFile;
+  for (auto &partition : this->partitions) {
+    partition->setTargetTriple(this->targetTriple);
+    auto objectFilename = objectsDir + JitObjectCache::hashModule(partition.get(), config) + ".o";
+    if (!llvm::sys::fs::exists(objectFilename)) {
+      // Write into a temp file then rename it to avoid leaving incomplete objects behind.
+      auto tempFilename = objectFilename + ".tmp";
+      this->optimizeModule(partition.get());
+      this->emitObjectFile(partition.get(), tempFilename.c_str());
+      if (llvm::sys::fs::rename(tempFilename, objectFilename)) {
+        llvm::sys::fs::remove(tempFilename);
+        throw EXCEPTION(FileException, objectFilename.c_str(), C('w'));
+      }
+    }
+    if (objectFilenames.insert(objectFilename).second) {
+      responseFile += C('"');
+      responseFile += objectFilename;
+      responseFile += S("\"\n");
+    }
+  }
+
+  // Write the linker response file.
+  std::string responseFilename = std::string(filename) + S(".objs");
+  {
+    std::ofstream fout(responseFilename, std::ios::binary | std::ios::trunc);
+    fout.write(responseFile.data(), responseFile.size());
+    if (fout.fail()) throw EXCEPTION(FileException, responseFilename.c_str(), C('w'));
+  }
+
+  // Remove objects of this target and config that are no longer part of the program.
+  std::error_code ec;
+  for (
+    llvm::sys::fs::directory_iterator iter(objectsDir, ec), end;
+    iter != end && !ec;
+    iter.increment(ec)
+  ) {
+    if (llvm::sys::path::extension(iter->path()) != ".o") continue;
+    if (objectFilenames.find(iter->path()) == objectFilenames.end()) llvm::sys::fs::remove(iter->path());
+  }
+}
+
+
+void OfflineBuildTarget::emitObjectFile(llvm::Module *module, Char const *filename)
+{
   std::error_code ec;
   llvm::raw_fd_ostream dest(filename, ec, llvm::sys::fs::F_None);
 
@@ -116,17 +270,92 @@ void OfflineBuildTarget::generateObjectFile(
   }
 
   llvm::legacy::PassManager pass;
-  auto fileType = llvm::CGFT_ObjectFile;
-
-  if (this->targetMachine->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
-    throw EXCEPTION(GenericException, S("TheTargetMachine can't emit a file of this type"));
+  if (this->ltoMode == LtoMode::THIN) {
+    // Code generation is done by the linker.
+    pass.add(llvm::createWriteThinLTOBitcodePass(dest));
+  } else {
+    auto fileType = llvm::CGFT_ObjectFile;
+    if (this->targetMachine->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
+      throw EXCEPTION(GenericException, S("TheTargetMachine can't emit a file of this type"));
+    }
   }
 
-  pass.run(*this->llvmModule);
+  pass.run(*module);
   dest.flush();
 }
 
 
+void OfflineBuildTarget::optimizeModule(llvm::Module *module)
+{
+  Bool profiling = !this->profileGenerateFilename.empty() || !this->profileUseFilename.empty();
+  if (this->optLevel == 0 && this->sizeLevel == 0 && !profiling) return;
+
+  llvm::PassManagerBuilder builder;
+  // Profile instrumentation and annotation are part of the optimization pipeline, which isn't used at level 0.
+  builder.OptLevel = profiling && this->optLevel == 0 ? 1 : this->optLevel;
+  builder.SizeLevel = this->sizeLevel;
+  builder.PrepareForThinLTO = this->ltoMode == LtoMode::THIN;
+  builder.EnablePGOInstrGen = !this->profileGenerateFilename.empty();
+  builder.PGOInstrGen = this->profileGenerateFilename;
+  builder.PGOInstrUse = this->profileUseFilename;
+  builder.Inliner = llvm::createFunctionInliningPass(builder.OptLevel, this->sizeLevel, false);
+  builder.LoopVectorize = this->optLevel > 1 && this->sizeLevel < 2;
+  builder.SLPVectorize = this->optLevel > 1 && this->sizeLevel < 2;
+  this->targetMachine->adjustPassManager(builder);
+
+  llvm::legacy::FunctionPassManager fnPasses(module);
+  fnPasses.add(llvm::createTargetTransformInfoWrapperPass(this->targetMachine->getTargetIRAnalysis()));
+  builder.populateFunctionPassManager(fnPasses);
+
+  llvm::legacy::PassManager passes;
+  passes.add(new llvm::TargetLibraryInfoWrapperPass(this->targetMachine->getTargetTriple()));
+  passes.add(llvm::createTargetTransformInfoWrapperPass(this->targetMachine->getTargetIRAnalysis()));
+  builder.populateModulePassManager(passes);
+
+  fnPasses.doInitialization();
+  for (llvm::Function &func : *module) {
+    fnPasses.run(func);
+  }
+  fnPasses.doFinalization();
+
+  passes.add(llvm::createVerifierPass());
+  passes.run(*module);
+}
+
+
+void OfflineBuildTarget::optimizeWholeProgram(llvm::Module *module)
+{
+  // Symbols that are exported by name (like those named with @expname) can be referenced from outside the program.
+  // Other symbols have generated names, which contain characters like '.' and '(', so they can only be referenced
+  // from within the program and can be internalized, allowing them to be inlined or removed if unused.
+  llvm::internalizeModule(*module, [](llvm::GlobalValue const &gv)->bool {
+    auto name = gv.getName();
+    if (name.startswith("llvm.")) return true;
+    for (Char c : name) {
+      if (!llvm::isAlnum(c) && c != C('_')) return false;
+    }
+    return true;
+  });
+
+  this->optimizeModule(module);
+
+  llvm::PassManagerBuilder builder;
+  builder.OptLevel = this->optLevel;
+  builder.SizeLevel = this->sizeLevel;
+  builder.Inliner = llvm::createFunctionInliningPass(this->optLevel, this->sizeLevel, false);
+  this->targetMachine->adjustPassManager(builder);
+
+  llvm::legacy::PassManager passes;
+  passes.add(new llvm::TargetLibraryInfoWrapperPass(this->targetMachine->getTargetTriple()));
+  passes.add(llvm::createTargetTransformInfoWrapperPass(this->targetMachine->getTargetIRAnalysis()));
+  builder.populateLTOPassManager(passes);
+  // Dead stripping is done even without optimizations.
+  passes.add(llvm::createGlobalDCEPass());
+  passes.add(llvm::createVerifierPass());
+  passes.run(*module);
+}
+
+
 void OfflineBuildTarget::buildCtorOrDtorArray(std::vector<Str> const *funcNames, Char const *globalVarName)
 {
   if (this->llvmModule == 0) {
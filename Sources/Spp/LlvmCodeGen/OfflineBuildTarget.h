@@ -27,6 +27,18 @@ class OfflineBuildTarget : public BuildTarget
   //============================================================================
   // Types
 
+  /**
+   * @brief The link time optimization modes.
+   *
+   * FULL optimizes the entire program as one module before generating code,
+   * after internalizing all symbols that aren't exported by name, which allows
+   * inlining across functions of different modules and the removal of unused
+   * functions. THIN emits LLVM bitcode with ThinLTO summaries instead of native
+   * code, leaving cross module optimizations to an LTO capable linker, like
+   * lld, which can then also optimize across other bitcode inputs.
+   */
+  public: s_enum(LtoMode, NONE = 0, FULL = 1, THIN = 2);
+
   private: struct LlvmGlobalCtorDtorEntryTypes
   {
     llvm::PointerType *llvmFuncPtrType = 0;
@@ -39,10 +51,56 @@ class OfflineBuildTarget : public BuildTarget
   // Member Variables
 
   private: std::string targetTriple;
+
+  /**
+   * @brief The CPU to generate code for.
+   *
+   * Can be set to "native" to generate code for the host's CPU, including all
+   * the features supported by it, as long as the target triple is the host's
+   * triple.
+   */
+  private: std::string cpu = "generic";
+  private: std::string cpuFeatures;
+
+  /// The optimization level, from 0 (no optimization) to 3.
+  private: Word optLevel = 0;
+
+  /// The size optimization level; 1 for -Os and 2 for -Oz.
+  private: Word sizeLevel = 0;
+
+  private: Word ltoMode = LtoMode::NONE;
+
+  /**
+   * @brief The file into which instrumented programs write their profiles.
+   *
+   * Profile instrumentation is disabled when this is empty. The profile
+   * runtime of compiler-rt must be linked into instrumented programs.
+   */
+  private: std::string profileGenerateFilename;
+
+  /// The indexed profile, generated by llvm-profdata, to optimize the program with.
+  private: std::string profileUseFilename;
+
   private: llvm::TargetMachine *targetMachine;
   private: std::unique_ptr<llvm::DataLayout> llvmDataLayout;
   private: std::unique_ptr<llvm::LLVMContext> llvmContext;
   private: std::unique_ptr<llvm::Module> llvmModule;
+
+  /**
+   * @brief The directory in which objects of incremental builds are kept.
+   *
+   * Incremental builds are disabled when this is empty. In incremental builds
+   * function modules are not linked into the program's module; instead each
+   * one is compiled into its own object file that is named after the hash of
+   * the module's IR, and only modules without an existing object are
+   * compiled. Objects are kept in a sub directory per target and code
+   * generation config.
+   */
+  private: std::string incrementalDir;
+
+  /// The function modules of the current incremental build.
+  private: std::vector<std::unique_ptr<llvm::Module>> partitions;
+
   private: LlvmGlobalCtorDtorEntryTypes llvmGlobalCtorDtorEntryTypes;
 
 
@@ -56,6 +114,7 @@ class OfflineBuildTarget : public BuildTarget
 
   public: virtual ~OfflineBuildTarget()
   {
+    this->partitions.clear();
     this->llvmModule.reset();
     this->llvmContext.reset();
   }
@@ -75,6 +134,108 @@ class OfflineBuildTarget : public BuildTarget
     return this->targetTriple;
   }
 
+  public: void setCpu(Char const *c, Char const *features)
+  {
+    this->cpu = (c == 0 || *c == C('\0')) ? "generic" : c;
+    this->cpuFeatures = features == 0 ? "" : features;
+  }
+
+  public: std::string const& getCpu() const
+  {
+    return this->cpu;
+  }
+
+  public: std::string const& getCpuFeatures() const
+  {
+    return this->cpuFeatures;
+  }
+
+  public: void setOptLevel(Word level)
+  {
+    OfflineBuildTarget::validateOptLevel(level);
+    this->optLevel = level;
+  }
+
+  public: static void validateOptLevel(Word level)
+  {
+    if (level > 3) {
+      throw EXCEPTION(InvalidArgumentException, S("level"), S("Optimization level must be between 0 and 3."), level);
+    }
+  }
+
+  public: Word getOptLevel() const
+  {
+    return this->optLevel;
+  }
+
+  public: void setSizeLevel(Word level)
+  {
+    OfflineBuildTarget::validateSizeLevel(level);
+    this->sizeLevel = level;
+  }
+
+  public: static void validateSizeLevel(Word level)
+  {
+    if (level > 2) {
+      throw EXCEPTION(InvalidArgumentException, S("level"), S("Size level must be between 0 and 2."), level);
+    }
+  }
+
+  public: Word getSizeLevel() const
+  {
+    return this->sizeLevel;
+  }
+
+  public: void setLtoMode(Word mode)
+  {
+    this->ltoMode = mode;
+  }
+
+  public: Word getLtoMode() const
+  {
+    return this->ltoMode;
+  }
+
+  /**
+   * @brief Set the directory of incremental builds, or null to disable them.
+   *
+   * Builds for different targets or with different options can share the
+   * directory since each gets its own sub directory. Builds of different
+   * programs for the same target and options should use different
+   * directories since objects that are no longer part of the program are
+   * removed from the sub directory.
+   */
+  public: void setIncrementalDir(Char const *dir)
+  {
+    this->incrementalDir = dir == 0 ? "" : dir;
+    if (!this->incrementalDir.empty() && this->incrementalDir.back() != C('/')) this->incrementalDir += C('/');
+  }
+
+  public: std::string const& getIncrementalDir() const
+  {
+    return this->incrementalDir;
+  }
+
+  public: void setProfileGenerateFilename(Char const *filename)
+  {
+    this->profileGenerateFilename = filename == 0 ? "" : filename;
+  }
+
+  public: std::string const& getProfileGenerateFilename() const
+  {
+    return this->profileGenerateFilename;
+  }
+
+  public: void setProfileUseFilename(Char const *filename)
+  {
+    this->profileUseFilename = filename == 0 ? "" : filename;
+  }
+
+  public: std::string const& getProfileUseFilename() const
+  {
+    return this->profileUseFilename;
+  }
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -96,12 +257,41 @@ class OfflineBuildTarget : public BuildTarget
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module);
 
+  /// One shot modules hold the entry and the global constructors, so they are always linked into the program's module.
+  public: virtual void addOneShotLlvmModule(std::unique_ptr<llvm::Module> module);
+
   public: Str generateLlvmIr(std::vector<Str> const *ctorNames, std::vector<Str> const *dtorNames);
 
+  /**
+   * @brief Generate the object file of the program.
+   *
+   * In incremental builds, the program's module is written to the given file
+   * while the objects of the function modules are written to the incremental
+   * build's directory. A linker response file listing these objects is then
+   * written next to the given file, with an .objs extension appended.
+   */
   public: void generateObjectFile(
     Char const *filename, std::vector<Str> const *ctorNames, std::vector<Str> const *dtorNames
   );
 
+  private: void resolveCpu(std::string &resolvedCpu, std::string &resolvedFeatures) const;
+
+  private: Bool isIncremental() const
+  {
+    // Full LTO needs the entire program in one module.
+    return !this->incrementalDir.empty() && this->ltoMode != LtoMode::FULL;
+  }
+
+  private: void generatePartitionObjects(Char const *filename);
+
+  private: void emitObjectFile(llvm::Module *module, Char const *filename);
+
+  private: void linkLlvmModule(std::unique_ptr<llvm::Module> module);
+
+  private: void optimizeModule(llvm::Module *module);
+
+  private: void optimizeWholeProgram(llvm::Module *module);
+
   private: void buildCtorOrDtorArray(std::vector<Str> const *funcNames, Char const *globalVarName);
 
 }; // class
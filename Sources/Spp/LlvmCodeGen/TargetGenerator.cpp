@@ -28,6 +28,7 @@ void TargetGenerator::initBindings()
   targetGeneration->generateFloatType = &TargetGenerator::generateFloatType;
   targetGeneration->generatePointerType = &TargetGenerator::generatePointerType;
   targetGeneration->generateArrayType = &TargetGenerator::generateArrayType;
+  targetGeneration->generateVectorType = &TargetGenerator::generateVectorType;
   targetGeneration->generateStructTypeDecl = &TargetGenerator::generateStructTypeDecl;
   targetGeneration->generateStructTypeBody = &TargetGenerator::generateStructTypeBody;
   targetGeneration->getTypeAllocationSize = &TargetGenerator::getTypeAllocationSize;
@@ -101,6 +102,16 @@ void TargetGenerator::initBindings()
   targetGeneration->generateOrAssign = &TargetGenerator::generateOrAssign;
   targetGeneration->generateXorAssign = &TargetGenerator::generateXorAssign;
   targetGeneration->generateNextArg = &TargetGenerator::generateNextArg;
+  targetGeneration->generateAtomicLoad = &TargetGenerator::generateAtomicLoad;
+  targetGeneration->generateAtomicStore = &TargetGenerator::generateAtomicStore;
+  targetGeneration->generateAtomicRmw = &TargetGenerator::generateAtomicRmw;
+  targetGeneration->generateAtomicCmpXchg = &TargetGenerator::generateAtomicCmpXchg;
+  targetGeneration->generateAtomicFence = &TargetGenerator::generateAtomicFence;
+  targetGeneration->generateVectorLoad = &TargetGenerator::generateVectorLoad;
+  targetGeneration->generateVectorStore = &TargetGenerator::generateVectorStore;
+  targetGeneration->generateVectorReduction = &TargetGenerator::generateVectorReduction;
+  targetGeneration->generateVectorReverse = &TargetGenerator::generateVectorReverse;
+  targetGeneration->generateVectorRotate = &TargetGenerator::generateVectorRotate;
 
   // Comparison Ops Generation Functions
   targetGeneration->generateEqual = &TargetGenerator::generateEqual;
@@ -117,6 +128,8 @@ void TargetGenerator::initBindings()
   targetGeneration->generateNullPtrLiteral = &TargetGenerator::generateNullPtrLiteral;
   targetGeneration->generateStructLiteral = &TargetGenerator::generateStructLiteral;
   targetGeneration->generateArrayLiteral = &TargetGenerator::generateArrayLiteral;
+  targetGeneration->generateVectorLiteral = &TargetGenerator::generateVectorLiteral;
+  targetGeneration->generateVectorSplat = &TargetGenerator::generateVectorSplat;
   targetGeneration->generatePointerLiteral = &TargetGenerator::generatePointerLiteral;
 }
 
@@ -200,6 +213,18 @@ Bool TargetGenerator::generateArrayType(TiObject *contentType, Word size, TioSha
 }
 
 
+Bool TargetGenerator::generateVectorType(TiObject *contentType, Word size, TioSharedPtr &type)
+{
+  PREPARE_ARG(contentType, contentTypeWrapper, Type);
+  if (!contentTypeWrapper->isDerivedFrom<IntegerType>() && !contentTypeWrapper->isDerivedFrom<FloatType>()) {
+    throw EXCEPTION(InvalidArgumentException, S("contentType"), S("Vectors can only contain integers or floats."));
+  }
+  auto llvmType = llvm::VectorType::get(contentTypeWrapper->getLlvmType(), size);
+  type = newSrdObj<VectorType>(llvmType, getSharedPtr(contentTypeWrapper), size);
+  return true;
+}
+
+
 Bool TargetGenerator::generateStructTypeDecl(
   Char const *name, TioSharedPtr &type
 ) {
@@ -403,7 +428,8 @@ Bool TargetGenerator::finishFunctionBody(
     LOG(
       Spp::LogLevel::LLVMCODEGEN_IR, S("Adding function module to build target: ") << funcWrapper->getName()
     );
-    this->buildTarget->addLlvmModule(std::move(funcWrapper->llvmModule));
+    if (funcWrapper->isOneShot()) this->buildTarget->addOneShotLlvmModule(std::move(funcWrapper->llvmModule));
+    else this->buildTarget->addLlvmModule(std::move(funcWrapper->llvmModule));
   }
 
   return true;
@@ -1151,7 +1177,8 @@ Bool TargetGenerator::generateAdd(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1184,7 +1211,8 @@ Bool TargetGenerator::generateSub(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1218,7 +1246,8 @@ Bool TargetGenerator::generateMul(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1244,7 +1273,8 @@ Bool TargetGenerator::generateDiv(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1270,7 +1300,8 @@ Bool TargetGenerator::generateRem(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
 
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1297,7 +1328,11 @@ Bool TargetGenerator::generateShr(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = ti_cast<IntegerType>(TargetGenerator::getScalarType(tgOpType));
+  if (tgType == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("type"), S("Must be an integer or a vector of integers."));
+  }
 
   llvm::Value *llvmResult;
   if (tgType->isSigned()) {
@@ -1316,7 +1351,11 @@ Bool TargetGenerator::generateShl(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = ti_cast<IntegerType>(TargetGenerator::getScalarType(tgOpType));
+  if (tgType == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("type"), S("Must be an integer or a vector of integers."));
+  }
 
   auto llvmResult = block->getIrBuilder()->CreateShl(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1330,7 +1369,11 @@ Bool TargetGenerator::generateAnd(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = ti_cast<IntegerType>(TargetGenerator::getScalarType(tgOpType));
+  if (tgType == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("type"), S("Must be an integer or a vector of integers."));
+  }
 
   auto llvmResult = block->getIrBuilder()->CreateAnd(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1344,7 +1387,11 @@ Bool TargetGenerator::generateOr(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = ti_cast<IntegerType>(TargetGenerator::getScalarType(tgOpType));
+  if (tgType == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("type"), S("Must be an integer or a vector of integers."));
+  }
 
   auto llvmResult = block->getIrBuilder()->CreateOr(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1358,7 +1405,11 @@ Bool TargetGenerator::generateXor(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = ti_cast<IntegerType>(TargetGenerator::getScalarType(tgOpType));
+  if (tgType == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("type"), S("Must be an integer or a vector of integers."));
+  }
 
   auto llvmResult = block->getIrBuilder()->CreateXor(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1371,7 +1422,11 @@ Bool TargetGenerator::generateNot(
 ) {
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal, srcValBox, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = ti_cast<IntegerType>(TargetGenerator::getScalarType(tgOpType));
+  if (tgType == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("type"), S("Must be an integer or a vector of integers."));
+  }
 
   auto llvmResult = block->getIrBuilder()->CreateNot(srcValBox->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1384,7 +1439,8 @@ Bool TargetGenerator::generateNeg(
 ) {
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal, srcValBox, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateNeg(srcValBox->getLlvmValue());
     result = newSrdObj<Value>(llvmResult, false);
@@ -1655,6 +1711,235 @@ Bool TargetGenerator::generateNextArg(
 }
 
 
+//==============================================================================
+// Atomic Ops Generation Functions
+
+Bool TargetGenerator::generateAtomicLoad(
+  TiObject *context, TiObject *type, TiObject *srcRef, CodeGen::AtomicOrdering order, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(srcRef, srcRefBox, Value);
+  auto llvmResult = block->getIrBuilder()->CreateLoad(srcRefBox->getLlvmValue());
+  llvmResult->setAtomic(TargetGenerator::getLlvmAtomicOrdering(order));
+  llvmResult->setAlignment(this->getAtomicAlignment(tgType));
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicStore(
+  TiObject *context, TiObject *type, TiObject *srcVal, TiObject *destRef, CodeGen::AtomicOrdering order,
+  TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  auto llvmStore = block->getIrBuilder()->CreateStore(srcValBox->getLlvmValue(), destRefBox->getLlvmValue());
+  llvmStore->setAtomic(TargetGenerator::getLlvmAtomicOrdering(order));
+  llvmStore->setAlignment(this->getAtomicAlignment(tgType));
+  result = getSharedPtr(destRef);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicRmw(
+  TiObject *context, TiObject *type, CodeGen::AtomicRmwOp op, TiObject *destRef, TiObject *srcVal,
+  CodeGen::AtomicOrdering order, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+
+  llvm::AtomicRMWInst::BinOp llvmOp;
+  switch (op.val) {
+    case CodeGen::AtomicRmwOp::XCHG: llvmOp = llvm::AtomicRMWInst::Xchg; break;
+    case CodeGen::AtomicRmwOp::ADD: llvmOp = llvm::AtomicRMWInst::Add; break;
+    case CodeGen::AtomicRmwOp::SUB: llvmOp = llvm::AtomicRMWInst::Sub; break;
+    case CodeGen::AtomicRmwOp::AND: llvmOp = llvm::AtomicRMWInst::And; break;
+    case CodeGen::AtomicRmwOp::OR: llvmOp = llvm::AtomicRMWInst::Or; break;
+    case CodeGen::AtomicRmwOp::XOR: llvmOp = llvm::AtomicRMWInst::Xor; break;
+    default: throw EXCEPTION(InvalidArgumentException, S("op"), S("Unknown atomic operation."), op.val);
+  }
+
+  auto irBuilder = block->getIrBuilder();
+  auto llvmOrder = TargetGenerator::getLlvmAtomicOrdering(order);
+  if (tgType->isDerivedFrom<IntegerType>()) {
+    auto llvmResult = irBuilder->CreateAtomicRMW(
+      llvmOp, destRefBox->getLlvmValue(), srcValBox->getLlvmValue(), llvmOrder
+    );
+    result = newSrdObj<Value>(llvmResult, false);
+    return true;
+  } else if (tgType->isDerivedFrom<PointerType>() && op == CodeGen::AtomicRmwOp::XCHG) {
+    // atomicrmw only accepts integers, so pointers are exchanged as integers of the same size.
+    auto llvmIntType = irBuilder->getIntPtrTy(*this->buildTarget->getLlvmDataLayout());
+    auto llvmDestRef = irBuilder->CreateBitCast(destRefBox->getLlvmValue(), llvmIntType->getPointerTo());
+    auto llvmSrcVal = irBuilder->CreatePtrToInt(srcValBox->getLlvmValue(), llvmIntType);
+    auto llvmResult = irBuilder->CreateAtomicRMW(llvmOp, llvmDestRef, llvmSrcVal, llvmOrder);
+    result = newSrdObj<Value>(irBuilder->CreateIntToPtr(llvmResult, tgType->getLlvmType()), false);
+    return true;
+  } else {
+    throw EXCEPTION(GenericException, S("Invalid operation."));
+  }
+}
+
+
+Bool TargetGenerator::generateAtomicCmpXchg(
+  TiObject *context, TiObject *type, TiObject *destRef, TiObject *cmpVal, TiObject *newVal,
+  CodeGen::AtomicOrdering order, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  PREPARE_ARG(cmpVal, cmpValBox, Value);
+  PREPARE_ARG(newVal, newValBox, Value);
+
+  // The failure ordering can't include a release since no store happens on failure.
+  auto llvmOrder = TargetGenerator::getLlvmAtomicOrdering(order);
+  auto llvmFailureOrder = llvm::AtomicCmpXchgInst::getStrongestFailureOrdering(llvmOrder);
+  auto llvmPair = block->getIrBuilder()->CreateAtomicCmpXchg(
+    destRefBox->getLlvmValue(), cmpValBox->getLlvmValue(), newValBox->getLlvmValue(), llvmOrder, llvmFailureOrder
+  );
+  auto llvmResult = block->getIrBuilder()->CreateExtractValue(llvmPair, 0);
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicFence(TiObject *context, CodeGen::AtomicOrdering order)
+{
+  PREPARE_ARG(context, block, Block);
+  if (order == CodeGen::AtomicOrdering::RELAXED) {
+    throw EXCEPTION(InvalidArgumentException, S("order"), S("Fences can't be relaxed."));
+  }
+  block->getIrBuilder()->CreateFence(TargetGenerator::getLlvmAtomicOrdering(order));
+  return true;
+}
+
+
+//==============================================================================
+// Vector Ops Generation Functions
+
+Bool TargetGenerator::generateVectorLoad(TiObject *context, TiObject *type, TiObject *srcPtr, TioSharedPtr &result)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, VectorType);
+  PREPARE_ARG(srcPtr, srcPtrBox, Value);
+  auto llvmPtr = block->getIrBuilder()->CreateBitCast(
+    srcPtrBox->getLlvmValue(), tgType->getLlvmType()->getPointerTo()
+  );
+  auto llvmResult = block->getIrBuilder()->CreateLoad(llvmPtr);
+  llvmResult->setAlignment(this->getElementAlignment(tgType));
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorStore(TiObject *context, TiObject *type, TiObject *srcVal, TiObject *destPtr)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, VectorType);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(destPtr, destPtrBox, Value);
+  auto llvmPtr = block->getIrBuilder()->CreateBitCast(
+    destPtrBox->getLlvmValue(), tgType->getLlvmType()->getPointerTo()
+  );
+  auto llvmStore = block->getIrBuilder()->CreateStore(srcValBox->getLlvmValue(), llvmPtr);
+  llvmStore->setAlignment(this->getElementAlignment(tgType));
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorReduction(
+  TiObject *context, Char const *op, TiObject *type, TiObject *srcVal, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, VectorType);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  auto irBuilder = block->getIrBuilder();
+  auto llvmVal = srcValBox->getLlvmValue();
+  auto contentType = tgType->getContentType().get();
+  auto intType = ti_cast<IntegerType>(contentType);
+  llvm::Value *llvmResult;
+  if (intType != 0) {
+    if (SBSTR(op) == S("sum")) llvmResult = irBuilder->CreateAddReduce(llvmVal);
+    else if (SBSTR(op) == S("product")) llvmResult = irBuilder->CreateMulReduce(llvmVal);
+    else if (SBSTR(op) == S("min")) llvmResult = irBuilder->CreateIntMinReduce(llvmVal, intType->isSigned());
+    else if (SBSTR(op) == S("max")) llvmResult = irBuilder->CreateIntMaxReduce(llvmVal, intType->isSigned());
+    else throw EXCEPTION(InvalidArgumentException, S("op"), S("Unknown vector reduction."), op);
+  } else {
+    // Float sums and products are ordered, so they add up the elements in the same order a loop would.
+    auto llvmContentType = contentType->getLlvmType();
+    if (SBSTR(op) == S("sum")) {
+      llvmResult = irBuilder->CreateFAddReduce(llvm::ConstantFP::getNegativeZero(llvmContentType), llvmVal);
+    } else if (SBSTR(op) == S("product")) {
+      llvmResult = irBuilder->CreateFMulReduce(llvm::ConstantFP::get(llvmContentType, 1.0), llvmVal);
+    } else if (SBSTR(op) == S("min")) {
+      llvmResult = irBuilder->CreateFPMinReduce(llvmVal);
+    } else if (SBSTR(op) == S("max")) {
+      llvmResult = irBuilder->CreateFPMaxReduce(llvmVal);
+    } else {
+      throw EXCEPTION(InvalidArgumentException, S("op"), S("Unknown vector reduction."), op);
+    }
+  }
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorReverse(TiObject *context, TiObject *type, TiObject *srcVal, TioSharedPtr &result)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, VectorType);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  Int size = tgType->getSize();
+  std::vector<Int> indexes;
+  for (Int i = 0; i < size; ++i) indexes.push_back(size - 1 - i);
+  result = newSrdObj<Value>(TargetGenerator::createShuffle(block, srcValBox->getLlvmValue(), indexes), false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorRotate(
+  TiObject *context, TiObject *type, TiObject *srcVal, TiObject *countVal, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, VectorType);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(countVal, countValBox, Value);
+  auto irBuilder = block->getIrBuilder();
+  Int size = tgType->getSize();
+  auto llvmVal = srcValBox->getLlvmValue();
+  auto llvmCount = countValBox->getLlvmValue();
+
+  auto llvmConstCount = llvm::dyn_cast<llvm::ConstantInt>(llvmCount);
+  if (llvmConstCount != 0) {
+    // The count is known, so we can rotate using a single shuffle.
+    Int count = llvmConstCount->getSExtValue();
+    std::vector<Int> indexes;
+    for (Int i = 0; i < size; ++i) indexes.push_back(((i + count) % size + size) % size);
+    result = newSrdObj<Value>(TargetGenerator::createShuffle(block, llvmVal, indexes), false);
+  } else {
+    // Normalize the count into [0, size) then move the elements one at a time.
+    auto llvmCountType = llvmCount->getType();
+    auto llvmSize = llvm::ConstantInt::get(llvmCountType, size);
+    auto llvmShift = irBuilder->CreateSRem(
+      irBuilder->CreateAdd(irBuilder->CreateSRem(llvmCount, llvmSize), llvmSize), llvmSize
+    );
+    llvm::Value *llvmResult = llvm::UndefValue::get(tgType->getLlvmType());
+    for (Int i = 0; i < size; ++i) {
+      auto llvmIndex = irBuilder->CreateURem(
+        irBuilder->CreateAdd(llvmShift, llvm::ConstantInt::get(llvmCountType, i)), llvmSize
+      );
+      llvmResult = irBuilder->CreateInsertElement(llvmResult, irBuilder->CreateExtractElement(llvmVal, llvmIndex), i);
+    }
+    result = newSrdObj<Value>(llvmResult, false);
+  }
+  return true;
+}
+
+
 //==============================================================================
 // Comparison Ops Generation Functions
 
@@ -1664,14 +1949,15 @@ Bool TargetGenerator::generateEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>() || tgType->isDerivedFrom<PointerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateICmpEQ(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else if (tgType->isDerivedFrom<FloatType>()) {
     auto llvmResult = block->getIrBuilder()->CreateFCmpOEQ(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else {
     throw EXCEPTION(GenericException, S("Invalid operation."));
@@ -1685,14 +1971,15 @@ Bool TargetGenerator::generateNotEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>() || tgType->isDerivedFrom<PointerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateICmpNE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else if (tgType->isDerivedFrom<FloatType>()) {
     auto llvmResult = block->getIrBuilder()->CreateFCmpONE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else {
     throw EXCEPTION(GenericException, S("Invalid operation."));
@@ -1706,7 +1993,8 @@ Bool TargetGenerator::generateGreaterThan(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1714,11 +2002,11 @@ Bool TargetGenerator::generateGreaterThan(
     } else {
       llvmResult = block->getIrBuilder()->CreateICmpUGT(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
     }
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else if (tgType->isDerivedFrom<FloatType>()) {
     auto llvmResult = block->getIrBuilder()->CreateFCmpOGT(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else {
     throw EXCEPTION(GenericException, S("Invalid operation."));
@@ -1732,7 +2020,8 @@ Bool TargetGenerator::generateGreaterThanOrEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1740,11 +2029,11 @@ Bool TargetGenerator::generateGreaterThanOrEqual(
     } else {
       llvmResult = block->getIrBuilder()->CreateICmpUGE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
     }
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else if (tgType->isDerivedFrom<FloatType>()) {
     auto llvmResult = block->getIrBuilder()->CreateFCmpOGE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else {
     throw EXCEPTION(GenericException, S("Invalid operation."));
@@ -1758,7 +2047,8 @@ Bool TargetGenerator::generateLessThan(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1766,11 +2056,11 @@ Bool TargetGenerator::generateLessThan(
     } else {
       llvmResult = block->getIrBuilder()->CreateICmpULT(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
     }
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else if (tgType->isDerivedFrom<FloatType>()) {
     auto llvmResult = block->getIrBuilder()->CreateFCmpOLT(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else {
     throw EXCEPTION(GenericException, S("Invalid operation."));
@@ -1784,7 +2074,8 @@ Bool TargetGenerator::generateLessThanOrEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(type, tgOpType, Type);
+  auto tgType = TargetGenerator::getScalarType(tgOpType);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1792,11 +2083,11 @@ Bool TargetGenerator::generateLessThanOrEqual(
     } else {
       llvmResult = block->getIrBuilder()->CreateICmpULE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
     }
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else if (tgType->isDerivedFrom<FloatType>()) {
     auto llvmResult = block->getIrBuilder()->CreateFCmpOLE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
-    result = newSrdObj<Value>(llvmResult, false);
+    result = newSrdObj<Value>(this->prepareComparisonResult(block, tgOpType, llvmResult), false);
     return true;
   } else {
     throw EXCEPTION(GenericException, S("Invalid operation."));
@@ -1915,6 +2206,42 @@ Bool TargetGenerator::generateArrayLiteral(
 }
 
 
+Bool TargetGenerator::generateVectorLiteral(
+  TiObject *context, TiObject *type, Containing<TiObject> *membersVals,
+  TioSharedPtr &destVal
+) {
+  PREPARE_ARG(type, tgType, VectorType);
+  VALIDATE_NOT_NULL(membersVals);
+  if (membersVals->getElementCount() != tgType->getSize()) {
+    throw EXCEPTION(InvalidArgumentException,
+      S("membersVals"), S("Element count does not match vector size."), membersVals->getElementCount()
+    );
+  }
+  std::vector<llvm::Constant*> vectorVals;
+  for (Word i = 0; i < membersVals->getElementCount(); ++i) {
+    auto value = ti_cast<Value>(membersVals->getElement(i));
+    if (value == 0) {
+      throw EXCEPTION(GenericException, S("Unexpected member value received."));
+    }
+    vectorVals.push_back(value->getLlvmConstant());
+  }
+  auto llvmResult = llvm::ConstantVector::get(vectorVals);
+  destVal = newSrdObj<Value>(llvmResult, true);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorSplat(TiObject *context, TiObject *type, TiObject *srcVal, TioSharedPtr &result)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, VectorType);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  auto llvmResult = block->getIrBuilder()->CreateVectorSplat(tgType->getSize(), srcValBox->getLlvmValue());
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
 Bool TargetGenerator::generatePointerLiteral(TiObject *context, TiObject *type, void *value, TioSharedPtr &destVal)
 {
   PREPARE_ARG(type, tgType, PointerType);
@@ -1934,6 +2261,61 @@ std::string TargetGenerator::getNewBlockName()
 }
 
 
+Type* TargetGenerator::getScalarType(Type *type)
+{
+  auto vectorType = ti_cast<VectorType>(type);
+  if (vectorType != 0) return vectorType->getContentType().get();
+  else return type;
+}
+
+
+llvm::AtomicOrdering TargetGenerator::getLlvmAtomicOrdering(CodeGen::AtomicOrdering order)
+{
+  switch (order.val) {
+    case CodeGen::AtomicOrdering::RELAXED: return llvm::AtomicOrdering::Monotonic;
+    case CodeGen::AtomicOrdering::ACQUIRE: return llvm::AtomicOrdering::Acquire;
+    case CodeGen::AtomicOrdering::RELEASE: return llvm::AtomicOrdering::Release;
+    case CodeGen::AtomicOrdering::ACQ_REL: return llvm::AtomicOrdering::AcquireRelease;
+    default: return llvm::AtomicOrdering::SequentiallyConsistent;
+  }
+}
+
+
+llvm::MaybeAlign TargetGenerator::getAtomicAlignment(Type *type)
+{
+  return llvm::MaybeAlign(this->buildTarget->getLlvmDataLayout()->getTypeStoreSize(type->getLlvmType()));
+}
+
+
+llvm::Align TargetGenerator::getElementAlignment(VectorType *type)
+{
+  return llvm::Align(
+    this->buildTarget->getLlvmDataLayout()->getABITypeAlignment(type->getContentType()->getLlvmType())
+  );
+}
+
+
+llvm::Value* TargetGenerator::createShuffle(Block *block, llvm::Value *llvmVector, std::vector<Int> const &indexes)
+{
+  auto llvmIndexType = llvm::Type::getInt32Ty(llvmVector->getContext());
+  std::vector<llvm::Constant*> llvmMask;
+  for (auto index : indexes) llvmMask.push_back(llvm::ConstantInt::get(llvmIndexType, index));
+  return block->getIrBuilder()->CreateShuffleVector(
+    llvmVector, llvm::UndefValue::get(llvmVector->getType()), llvm::ConstantVector::get(llvmMask)
+  );
+}
+
+
+llvm::Value* TargetGenerator::prepareComparisonResult(Block *block, Type *type, llvm::Value *llvmResult)
+{
+  auto vectorType = ti_cast<VectorType>(type);
+  if (vectorType == 0) return llvmResult;
+  return block->getIrBuilder()->CreateSExt(
+    llvmResult, llvm::VectorType::getInteger(static_cast<llvm::VectorType*>(vectorType->getLlvmType()))
+  );
+}
+
+
 std::string TargetGenerator::getAnonymouseVarName()
 {
   return std::string("#anonymous") + std::to_string(this->anonymousVarIndex++);
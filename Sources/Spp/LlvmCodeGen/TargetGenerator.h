@@ -103,6 +103,8 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   public: Bool generateArrayType(TiObject *contentType, Word size, TioSharedPtr &type);
 
+  public: Bool generateVectorType(TiObject *contentType, Word size, TioSharedPtr &type);
+
   public: Bool generateStructTypeDecl(
     Char const *name, TioSharedPtr &type
   );
@@ -357,6 +359,55 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   /// @}
 
+  /// @name Atomic Ops Generation Functions
+  /// @{
+
+  public: Bool generateAtomicLoad(
+    TiObject *context, TiObject *type, TiObject *srcRef, CodeGen::AtomicOrdering order, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicStore(
+    TiObject *context, TiObject *type, TiObject *srcVal, TiObject *destRef, CodeGen::AtomicOrdering order,
+    TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicRmw(
+    TiObject *context, TiObject *type, CodeGen::AtomicRmwOp op, TiObject *destRef, TiObject *srcVal,
+    CodeGen::AtomicOrdering order, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicCmpXchg(
+    TiObject *context, TiObject *type, TiObject *destRef, TiObject *cmpVal, TiObject *newVal,
+    CodeGen::AtomicOrdering order, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicFence(TiObject *context, CodeGen::AtomicOrdering order);
+
+  /// @}
+
+  /// @name Vector Ops Generation Functions
+  /// @{
+
+  /// Load a vector from a pointer to its elements, which only needs to be aligned for the element type.
+  public: Bool generateVectorLoad(TiObject *context, TiObject *type, TiObject *srcPtr, TioSharedPtr &result);
+
+  /// Store a vector into a pointer to its elements, which only needs to be aligned for the element type.
+  public: Bool generateVectorStore(TiObject *context, TiObject *type, TiObject *srcVal, TiObject *destPtr);
+
+  /// Reduce the elements of a vector using the given op, which is one of: sum, product, min, or max.
+  public: Bool generateVectorReduction(
+    TiObject *context, Char const *op, TiObject *type, TiObject *srcVal, TioSharedPtr &result
+  );
+
+  public: Bool generateVectorReverse(TiObject *context, TiObject *type, TiObject *srcVal, TioSharedPtr &result);
+
+  /// Move each element `count` positions towards the beginning of the vector, wrapping around to the end.
+  public: Bool generateVectorRotate(
+    TiObject *context, TiObject *type, TiObject *srcVal, TiObject *countVal, TioSharedPtr &result
+  );
+
+  /// @}
+
   /// @name Comparison Ops Generation Functions
   /// @{
 
@@ -415,6 +466,14 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
     TioSharedPtr &destVal
   );
 
+  public: Bool generateVectorLiteral(
+    TiObject *context, TiObject *type, Containing<TiObject> *membersVals,
+    TioSharedPtr &destVal
+  );
+
+  /// Generate a vector with all its elements set to the given scalar value.
+  public: Bool generateVectorSplat(TiObject *context, TiObject *type, TiObject *srcVal, TioSharedPtr &result);
+
   public: Bool generatePointerLiteral(TiObject *context, TiObject *type, void *value, TioSharedPtr &destVal);
 
   /// @}
@@ -424,6 +483,28 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   private: std::string getNewBlockName();
 
+  /// Get the element type of vector types, or the type itself for scalar types.
+  private: static Type* getScalarType(Type *type);
+
+  /// Map an atomic ordering into its LLVM equivalent, with relaxed mapped into monotonic.
+  private: static llvm::AtomicOrdering getLlvmAtomicOrdering(CodeGen::AtomicOrdering order);
+
+  /// Get the alignment of atomic accesses of the given type, which is the type's natural alignment.
+  private: llvm::MaybeAlign getAtomicAlignment(Type *type);
+
+  /// Get the alignment of the elements of the given vector type.
+  private: llvm::Align getElementAlignment(VectorType *type);
+
+  /// Shuffle the elements of a vector into a new vector using constant element indexes.
+  private: static llvm::Value* createShuffle(Block *block, llvm::Value *llvmVector, std::vector<Int> const &indexes);
+
+  /**
+   * @brief Convert the result of comparing two values of the given type.
+   * Comparing vectors results in a vector of booleans, which is converted into
+   * a mask vector with all the bits of each element set for true elements.
+   */
+  private: llvm::Value* prepareComparisonResult(Block *block, Type *type, llvm::Value *llvmResult);
+
   private: std::string getAnonymouseVarName();
 
   /// @}
@@ -23,6 +23,8 @@ Error JitEngineBuilderState::prepareForConstruction() {
       return JTMBOrErr.takeError();
   }
 
+  jtmb->setCodeGenOptLevel(JitEngineBuilderState::getCodeGenOptLevel(optLevel));
+
   // If the client didn't configure any linker options then auto-configure the
   // JIT linker.
   if (!createObjectLinkingLayer && jtmb->getCodeModel() == None &&
@@ -63,13 +65,25 @@ Error JitEngine::defineAbsolute(StringRef name, JITEvaluatedSymbol sym) {
 }
 
 
-Error JitEngine::addIRModule(JITDylib &jd, ThreadSafeModule tsm) {
+Error JitEngine::addIRModule(JITDylib &jd, ThreadSafeModule tsm, Bool optimize) {
   assert(tsm && "Can not add null module");
 
   if (auto err = tsm.withModuleDo([&](Module &m) { return applyDataLayout(m); }))
     return err;
 
-  if (optimizeLayer.get() != 0) {
+  if (!optimize || optimizeLayer.get() == 0) optimize = false;
+
+  if (this->objectCache != 0) {
+    // Every module is tagged before reaching any layer since both optimization and code generation change the IR,
+    // which would otherwise make the key computed when the object is stored differ from the one computed when it's
+    // looked up. The level is fixed here so the module is optimized with the level its key was computed for.
+    Word level = optimize ? static_cast<Word>(this->optLevel) : 0;
+    Bool cached = tsm.withModuleDo([&](Module &m) { return this->objectCache->tagModule(m, level); });
+    // Modules with cached objects will be loaded from the cache by the compile layer.
+    if (cached || level == 0) optimize = false;
+  }
+
+  if (optimize) {
     return optimizeLayer->add(jd, std::move(tsm), es->allocateVModule());
   } else {
     return compileLayer->add(jd, std::move(tsm), es->allocateVModule());
@@ -125,13 +139,13 @@ Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> JitEngine::createCompileFu
   // Otherwise default to creating a SimpleCompiler, or ConcurrentIRCompiler,
   // depending on the number of threads requested.
   if (s.numCompileThreads > 0)
-    return std::make_unique<ConcurrentIRCompiler>(std::move(jtmb));
+    return std::make_unique<ConcurrentIRCompiler>(std::move(jtmb), s.objectCache);
 
   auto TM = jtmb.createTargetMachine();
   if (!TM)
     return TM.takeError();
 
-  return std::make_unique<TMOwningSimpleCompiler>(std::move(*TM));
+  return std::make_unique<TMOwningSimpleCompiler>(std::move(*TM), s.objectCache);
 }
 
 
@@ -140,7 +154,7 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
       main(this->es->createJITDylib("<main>")), dl(""),
       objLinkingLayer(createObjectLinkingLayer(s, *es)),
       objTransformLayer(*this->es, *objLinkingLayer), ctorRunner(main),
-      dtorRunner(main) {
+      dtorRunner(main), optLevel(s.optLevel), objectCache(s.objectCache) {
 
   ErrorAsOutParameter _(&err);
 
@@ -176,6 +190,9 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
 
   if (useOptimizeLayer) {
     optimizeLayer = createOptimizeLayer(*compileLayer);
+    // Modules are moved into their own contexts before being optimized to avoid sharing a context between the
+    // compile threads.
+    if (s.numCompileThreads > 0) optimizeLayer->setCloneToNewContextOnEmit(true);
   }
 }
 
@@ -184,18 +201,27 @@ std::unique_ptr<llvm::orc::IRTransformLayer> JitEngine::createOptimizeLayer(llvm
   auto optimizeLayer = std::make_unique<IRTransformLayer>(*es, prevLayer);
 
   static llvm::Expected<llvm::orc::JITTargetMachineBuilder> tmb = llvm::orc::JITTargetMachineBuilder::detectHost();
-  static std::unique_ptr<llvm::TargetMachine> targetMachine = std::move(tmb.get().createTargetMachine().get());
-  static llvm::PassManagerBuilder builder;
-  builder.OptLevel = 3; // TODO: what is the most appropriate level to use?
-  builder.SizeLevel = 0;
-  builder.Inliner = llvm::createFunctionInliningPass(3, 0, false);
-  builder.LoopVectorize = true;
-  builder.SLPVectorize = true;
-  targetMachine->adjustPassManager(builder);
 
   optimizeLayer->setTransform(
-    [&](llvm::orc::ThreadSafeModule tsm, const llvm::orc::MaterializationResponsibility &r) {
+    [this](llvm::orc::ThreadSafeModule tsm, const llvm::orc::MaterializationResponsibility &r) {
+      // Modules tagged for the object cache must be optimized with the level their keys were computed for.
+      Int taggedLevel = tsm.withModuleDo([](llvm::Module &module) {
+        return JitObjectCache::getTaggedOptLevel(module);
+      });
+      Word level = taggedLevel >= 0 ? taggedLevel : static_cast<Word>(this->optLevel);
+      if (level == 0) return tsm;
+      // Modules can be optimized concurrently on the compile threads, so each thread needs its own target machine.
+      static thread_local std::unique_ptr<llvm::TargetMachine> targetMachine =
+        std::move(tmb.get().createTargetMachine().get());
       tsm.withModuleDo([&](llvm::Module &module) {
+        llvm::PassManagerBuilder builder;
+        builder.OptLevel = level;
+        builder.SizeLevel = 0;
+        builder.Inliner = llvm::createFunctionInliningPass(level, 0, false);
+        builder.LoopVectorize = level > 1;
+        builder.SLPVectorize = level > 1;
+        targetMachine->adjustPassManager(builder);
+
         llvm::legacy::PassManager passes;
         passes.add(new llvm::TargetLibraryInfoWrapperPass(targetMachine->getTargetTriple()));
         passes.add(llvm::createTargetTransformInfoWrapperPass(targetMachine->getTargetIRAnalysis()));
@@ -205,7 +231,7 @@ std::unique_ptr<llvm::orc::IRTransformLayer> JitEngine::createOptimizeLayer(llvm
 
         builder.populateFunctionPassManager(fnPasses);
         builder.populateModulePassManager(passes);
-        builder.populateLTOPassManager(passes);
+        if (level > 2) builder.populateLTOPassManager(passes);
 
         fnPasses.doInitialization();
         for (llvm::Function &func : module) {
@@ -330,6 +356,7 @@ LazyJitEngine::LazyJitEngine(LazyJitEngineBuilderState &s, Error &err) : JitEngi
     codLayer->setCloneToNewContextOnEmit(true);
 
   optimizeLayer = createOptimizeLayer(*codLayer);
+  if (s.numCompileThreads > 0) optimizeLayer->setCloneToNewContextOnEmit(true);
 }
 
 } // namespace
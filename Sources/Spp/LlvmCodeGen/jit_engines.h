@@ -35,6 +35,12 @@ class JitEngine
 
   protected: llvm::orc::CtorDtorRunner ctorRunner, dtorRunner;
 
+  /// The level of IR optimizations applied to modules added to this instance.
+  protected: std::atomic<Word> optLevel;
+
+  /// The cache of compiled objects, if any.
+  protected: JitObjectCache *objectCache;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -80,12 +86,20 @@ class JitEngine
   /// Convenience method for defining an absolute symbol.
   public: llvm::Error defineAbsolute(llvm::StringRef name, llvm::JITEvaluatedSymbol address);
 
-  /// Adds an IR module to the given JITDylib.
-  public: llvm::Error addIRModule(llvm::orc::JITDylib &jd, llvm::orc::ThreadSafeModule tsm);
+  /// Sets the level of IR optimizations applied to modules added after this
+  /// call. The code generation level is fixed when the instance is created.
+  public: void setOptLevel(Word level) { optLevel = level; }
+
+  /// Returns the level of IR optimizations applied to added modules.
+  public: Word getOptLevel() const { return optLevel; }
+
+  /// Adds an IR module to the given JITDylib. Modules of code that is only run
+  /// once can skip IR optimizations by setting optimize to false.
+  public: llvm::Error addIRModule(llvm::orc::JITDylib &jd, llvm::orc::ThreadSafeModule tsm, Bool optimize = true);
 
   /// Adds an IR module to the main JITDylib.
-  public: llvm::Error addIRModule(llvm::orc::ThreadSafeModule tsm) {
-    return addIRModule(main, std::move(tsm));
+  public: llvm::Error addIRModule(llvm::orc::ThreadSafeModule tsm, Bool optimize = true) {
+    return addIRModule(main, std::move(tsm), optimize);
   }
 
   /// Adds an object file to the given JITDylib.
@@ -220,9 +234,21 @@ class JitEngineBuilderState
   public: ObjectLinkingLayerCreator createObjectLinkingLayer;
   public: CompileFunctionCreator createCompileFunction;
   public: unsigned numCompileThreads = 0;
+  public: Word optLevel = 3;
+  public: JitObjectCache *objectCache = 0;
 
   /// Called prior to JIT class construcion to fix up defaults.
   public: llvm::Error prepareForConstruction();
+
+  /// Get the code generation level used for the given optimization level.
+  public: static llvm::CodeGenOpt::Level getCodeGenOptLevel(Word optLevel)
+  {
+    switch (optLevel) {
+      case 0: return llvm::CodeGenOpt::None;
+      case 1: return llvm::CodeGenOpt::Less;
+      default: return llvm::CodeGenOpt::Default;
+    }
+  }
 };
 
 
@@ -311,6 +337,28 @@ class JitEngineBuilderSetters
     return impl();
   }
 
+  /// Set the optimization level, from 0 to 3.
+  ///
+  /// The level determines both the IR optimization pipeline applied to added
+  /// modules and the code generation level of the target machine. Level 0
+  /// skips IR optimizations and enables fast instruction selection.
+  ///
+  /// If this method is not called, behavior will be as if it were called with
+  /// 3.
+  public: SETTER_IMPL& setOptLevel(Word optLevel) {
+    impl().optLevel = optLevel;
+    return impl();
+  }
+
+  /// Set the cache of compiled objects.
+  ///
+  /// Optimizing and compiling modules is skipped for modules that have
+  /// objects in the cache. The cache must outlive the JIT instance.
+  public: SETTER_IMPL& setObjectCache(JitObjectCache *objectCache) {
+    impl().objectCache = objectCache;
+    return impl();
+  }
+
   /// Create an instance of the JIT.
   public: llvm::Expected<std::unique_ptr<JIT_TYPE>> create(CodeGen::GlobalItemRepo *itemRepo) {
     if (auto err = impl().prepareForConstruction())
@@ -48,6 +48,7 @@ void llvmDiagnosticCallback(const llvm::DiagnosticInfo &di, void *context);
 #include "LoopContext.h"
 
 // The Generator
+#include "JitObjectCache.h"
 #include "jit_engines.h"
 #include "TargetGenerator.h"
 #include "BuildTarget.h"
@@ -251,6 +251,54 @@ class ArrayType : public Type
 }; // class
 
 
+//==============================================================================
+// VectorType
+
+class VectorType : public Type
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(VectorType, Type, "Spp.LlvmCodeGen", "Spp", "alusus.org");
+
+
+  //============================================================================
+  // Member Variables
+
+  private: llvm::VectorType *llvmType;
+  private: SharedPtr<Type> contentType;
+  private: Word size;
+
+
+  //============================================================================
+  // Constructor & Destructor
+
+  public: VectorType(llvm::VectorType *t, SharedPtr<Type> const &ct, Word s) : llvmType(t), contentType(ct), size(s)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: virtual llvm::Type* getLlvmType() const
+  {
+    return this->llvmType;
+  }
+
+  public: SharedPtr<Type> const& getContentType() const
+  {
+    return this->contentType;
+  }
+
+  public: Word getSize() const
+  {
+    return this->size;
+  }
+
+}; // class
+
+
 //==============================================================================
 // StructType
 
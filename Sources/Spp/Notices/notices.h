@@ -259,6 +259,22 @@ DEFINE_NOTICE(IncompleteOutfixOpNotice, "Spp.Notices", "Spp", "alusus.org", "SPP
   "Incomplete prefix or postfix operator. This is likely caused by a macro or a preprocess statement that evaluated"
   " to null."
 );
+DEFINE_NOTICE(InvalidAtomicOperandNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1039", 1,
+  "Invalid operand for ~atomic operator. Atomic operations are only allowed on integer and pointer variables."
+);
+DEFINE_NOTICE(InvalidAtomicOperationNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1040", 1,
+  "Invalid atomic operation, arguments, or memory ordering."
+);
+DEFINE_NOTICE(InvalidVectorTypeNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1041", 1,
+  "Invalid vector type. Vectors must have a positive size and contain integers or floats."
+);
+DEFINE_NOTICE(InvalidIntrinsicNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1042", 1,
+  "Unknown intrinsic, or the intrinsic's function signature does not match it."
+);
+DEFINE_NOTICE(InvalidAtomicPointerOperationNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1043", 1,
+  "Invalid atomic operation on a pointer. Pointers can only be loaded, stored, exchanged, or compared and exchanged"
+  " atomically. Cast the pointer to ArchInt for atomic arithmetic."
+);
 
 } // namespace
 
@@ -21,7 +21,13 @@ void BuildMgr::initBindingCaches()
 {
   Basic::initBindingCaches(this, {
     &this->dumpLlvmIrForElement,
-    &this->buildObjectFileForElement
+    &this->buildObjectFileForElement,
+    &this->setOfflineBuildOptions,
+    &this->setOfflineIncrementalDir,
+    &this->setOfflineLtoMode,
+    &this->setOfflineProfileOptions,
+    &this->setJitOptLevel,
+    &this->getJitOptLevel
   });
 }
 
@@ -30,6 +36,12 @@ void BuildMgr::initBindings()
 {
   this->dumpLlvmIrForElement = &BuildMgr::_dumpLlvmIrForElement;
   this->buildObjectFileForElement = &BuildMgr::_buildObjectFileForElement;
+  this->setOfflineBuildOptions = &BuildMgr::_setOfflineBuildOptions;
+  this->setOfflineIncrementalDir = &BuildMgr::_setOfflineIncrementalDir;
+  this->setOfflineLtoMode = &BuildMgr::_setOfflineLtoMode;
+  this->setOfflineProfileOptions = &BuildMgr::_setOfflineProfileOptions;
+  this->setJitOptLevel = &BuildMgr::_setJitOptLevel;
+  this->getJitOptLevel = &BuildMgr::_getJitOptLevel;
 }
 
 
@@ -38,6 +50,16 @@ void BuildMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo
   globalItemRepo->addItem(S("!Spp.buildMgr"), sizeof(void*), &buildMgr);
   globalItemRepo->addItem(S("Spp_BuildMgr_dumpLlvmIrForElement"), (void*)&BuildMgr::_dumpLlvmIrForElement);
   globalItemRepo->addItem(S("Spp_BuildMgr_buildObjectFileForElement"), (void*)&BuildMgr::_buildObjectFileForElement);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setOfflineBuildOptions"), (void*)&BuildMgr::_setOfflineBuildOptions);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_setOfflineIncrementalDir"), (void*)&BuildMgr::_setOfflineIncrementalDir
+  );
+  globalItemRepo->addItem(S("Spp_BuildMgr_setOfflineLtoMode"), (void*)&BuildMgr::_setOfflineLtoMode);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_setOfflineProfileOptions"), (void*)&BuildMgr::_setOfflineProfileOptions
+  );
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitOptLevel"), (void*)&BuildMgr::_setJitOptLevel);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitOptLevel"), (void*)&BuildMgr::_getJitOptLevel);
 }
 
 
@@ -60,4 +82,47 @@ Bool BuildMgr::_buildObjectFileForElement(
   );
 }
 
+
+void BuildMgr::_setOfflineBuildOptions(
+  TiObject *self, Word optLevel, Word sizeLevel, Char const *cpu, Char const *cpuFeatures
+) {
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setOfflineBuildOptions(optLevel, sizeLevel, cpu, cpuFeatures);
+}
+
+
+void BuildMgr::_setOfflineIncrementalDir(TiObject *self, Char const *dir)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setOfflineIncrementalDir(dir);
+}
+
+
+void BuildMgr::_setOfflineLtoMode(TiObject *self, Word mode)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setOfflineLtoMode(mode);
+}
+
+
+void BuildMgr::_setOfflineProfileOptions(TiObject *self, Char const *generateFilename, Char const *useFilename)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setOfflineProfileOptions(generateFilename, useFilename);
+}
+
+
+void BuildMgr::_setJitOptLevel(TiObject *self, Int buildType, Word optLevel)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setJitOptLevel(buildType, optLevel);
+}
+
+
+Word BuildMgr::_getJitOptLevel(TiObject *self, Int buildType)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getJitOptLevel(buildType);
+}
+
 } // namespace
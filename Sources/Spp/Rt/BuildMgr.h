@@ -109,6 +109,28 @@ class BuildMgr : public TiObject, public DynamicBinding, public DynamicInterfaci
     TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
   );
 
+  public: METHOD_BINDING_CACHE(setOfflineBuildOptions, void, (Word, Word, Char const*, Char const*));
+  public: static void _setOfflineBuildOptions(
+    TiObject *self, Word optLevel, Word sizeLevel, Char const *cpu, Char const *cpuFeatures
+  );
+
+  public: METHOD_BINDING_CACHE(setOfflineIncrementalDir, void, (Char const*));
+  public: static void _setOfflineIncrementalDir(TiObject *self, Char const *dir);
+
+  public: METHOD_BINDING_CACHE(setOfflineLtoMode, void, (Word));
+  public: static void _setOfflineLtoMode(TiObject *self, Word mode);
+
+  public: METHOD_BINDING_CACHE(setOfflineProfileOptions, void, (Char const*, Char const*));
+  public: static void _setOfflineProfileOptions(
+    TiObject *self, Char const *generateFilename, Char const *useFilename
+  );
+
+  public: METHOD_BINDING_CACHE(setJitOptLevel, void, (Int, Word));
+  public: static void _setJitOptLevel(TiObject *self, Int buildType, Word optLevel);
+
+  public: METHOD_BINDING_CACHE(getJitOptLevel, Word, (Int));
+  public: static Word _getJitOptLevel(TiObject *self, Int buildType);
+
   /// @}
 
 }; // class
@@ -54,6 +54,9 @@ SeekerExtension::Overrides* SeekerExtension::extend(Core::Data::Seeker *seeker,
   overrides->foreachByComparison_computeRef =
     extension->foreachByComparison_compute.set(&SeekerExtension::_foreachByComparison_compute).get();
 
+  // Lookup results cached before the extension was added no longer apply.
+  seeker->clearCache();
+
   return overrides;
 }
 
@@ -79,6 +82,8 @@ void SeekerExtension::unextend(Core::Data::Seeker *seeker, Overrides *overrides)
 
   seeker->removeDynamicInterface<SeekerExtension>();
   delete overrides;
+
+  seeker->clearCache();
 }
 
 
@@ -162,6 +167,8 @@ Core::Data::Seeker::Verb SeekerExtension::_foreachByIdentifier_function(
 ) {
   auto argTypes = function->getType()->getArgTypes().get();
   if (argTypes == 0) return Core::Data::Seeker::Verb::MOVE;
+  PREPARE_SELF(seeker, Core::Data::Seeker);
+  seeker->watchForChanges(argTypes);
   auto index = argTypes->findIndex(identifier->getValue().get());
   if (index >= 0) return cb(Core::Data::Seeker::Action::TARGET_MATCH, argTypes->getElement(index));
   return Core::Data::Seeker::Verb::MOVE;
@@ -147,12 +147,21 @@ template <class T> class Array
     ++this->data->length;
   }
 
+  public: void set (ArchInt index, T item) {
+    if (index < 0 || index >= this->getLength()) {
+      this->add(item);
+    } else {
+      this->_prepareToModify(false);
+      this->data->buf[index] = item;
+    }
+  }
+
   public: void insert (ArchInt index, T item) {
     if (index < 0 || index >= this->getLength()) {
       this->add(item);
     } else {
       this->_prepareToModify(true);
-      memcpy(this->data->buf + index + 1, this->data->buf + index, sizeof(T) * (this->data->length - index));
+      memmove(this->data->buf + index + 1, this->data->buf + index, sizeof(T) * (this->data->length - index));
       new(this->data->buf + index) T(item);
       ++this->data->length;
     }
@@ -163,7 +172,7 @@ template <class T> class Array
       this->_prepareToModify(false);
       this->data->buf[index].~T();
       if (index < this->getLength() - 1) {
-        memcpy(this->data->buf + index, this->data->buf + index + 1, sizeof(T) * (this->data->length - (index + 1)));
+        memmove(this->data->buf + index, this->data->buf + index + 1, sizeof(T) * (this->data->length - (index + 1)));
       };
       --this->data->length;
     }
@@ -0,0 +1,269 @@
+/**
+ * @file Srl/HashIndex.h
+ * Contains the classes Srl::Hashing and Srl::HashIndex.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SRL_HASHINDEX_H
+#define SRL_HASHINDEX_H
+
+namespace Srl
+{
+
+/**
+ * @brief Default hash functions used by HashIndex and HashMap.
+ * @ingroup srl
+ *
+ * Strings are hashed by content while pointers are hashed by address. These
+ * produce the same hashes as Srl.Hashing in the Alusus Srl.
+ */
+class Hashing {
+  public: static PtrWord hashBytes(void const *p, ArchInt size) {
+    // FNV-1a
+    Byte const *bytes = reinterpret_cast<Byte const*>(p);
+    PtrWord h = 14695981039346656037ul;
+    for (ArchInt i = 0; i < size; ++i) {
+      h ^= bytes[i];
+      h *= 1099511628211ul;
+    }
+    return h;
+  }
+
+  public: static PtrWord hash(LongWord v) {
+    // The finalizer of MurmurHash3, which spreads the entropy into the lower bits that are used for bucket selection.
+    v ^= v >> 33;
+    v *= 0xff51afd7ed558ccdul;
+    v ^= v >> 33;
+    return v;
+  }
+
+  public: static PtrWord hash(void const *p) {
+    return hash(reinterpret_cast<PtrWord>(p));
+  }
+
+  public: template<class T> static PtrWord hash(StringBase<T> const &s) {
+    return hashBytes(s.getBuf(), s.getLength() * sizeof(T));
+  }
+}; // class
+
+
+class HashIndexSlot {
+  public: ArchInt pos;
+  public: PtrWord hash;
+}; // class
+
+
+/**
+ * @brief An open addressing hash index over the items of an array.
+ * @ingroup srl
+ *
+ * Maps values of the indexed array to their positions using linear probing.
+ * The index doesn't keep a reference to the array; the array is passed to
+ * every call that needs to read its items, so the owner of the array and the
+ * index can be moved freely in memory. Lookups, appends and removals of the
+ * last item are O(1) amortized, while inserting or removing items in the
+ * middle of the array needs the stored positions of the following items to be
+ * shifted. Removed slots are refilled by shifting back the slots that follow
+ * them, so no tombstones are kept.
+ */
+template<class T> class HashIndex {
+  //=================
+  // Member Variables
+
+  private: HashIndexSlot *slots;
+  private: ArchInt capacity;
+  private: ArchInt count;
+  private: PtrWord (*hashFn)(T const&);
+  private: Bool (*isEqualFn)(T const&, T const&);
+
+  //===============
+  // Initialization
+
+  public: HashIndex() {
+    this->_init(&HashIndex<T>::defaultHash, &HashIndex<T>::defaultIsEqual);
+  }
+
+  public: HashIndex(PtrWord (*hashFn)(T const&), Bool (*isEqualFn)(T const&, T const&)) {
+    this->_init(hashFn, isEqualFn);
+  }
+
+  public: HashIndex(HashIndex<T> const &src) {
+    this->_init(src.hashFn, src.isEqualFn);
+    this->assign(src);
+  }
+
+  public: ~HashIndex() {
+    if (this->slots != 0) free(this->slots);
+  }
+
+  private: void _init(PtrWord (*hashFn)(T const&), Bool (*isEqualFn)(T const&, T const&)) {
+    this->slots = 0;
+    this->capacity = 0;
+    this->count = 0;
+    this->hashFn = hashFn;
+    this->isEqualFn = isEqualFn;
+  }
+
+  //=================
+  // Member Functions
+
+  public: static PtrWord defaultHash(T const &v) {
+    return Hashing::hash(v);
+  }
+
+  public: static Bool defaultIsEqual(T const &v1, T const &v2) {
+    return v1 == v2;
+  }
+
+  /// Copy the index of another array that has the same items as this index's array.
+  public: void assign(HashIndex<T> const &src) {
+    if (this->slots != 0) free(this->slots);
+    this->slots = 0;
+    this->capacity = src.capacity;
+    this->count = src.count;
+    this->hashFn = src.hashFn;
+    this->isEqualFn = src.isEqualFn;
+    if (src.slots != 0) {
+      this->slots = reinterpret_cast<HashIndexSlot*>(malloc(sizeof(HashIndexSlot) * this->capacity));
+      memcpy(this->slots, src.slots, sizeof(HashIndexSlot) * this->capacity);
+    }
+  }
+
+  public: HashIndex<T>& operator=(HashIndex<T> const &src) {
+    if (this != &src) this->assign(src);
+    return *this;
+  }
+
+  /// Index the item at the given position, or all the items at the end of the array that aren't indexed yet if -1.
+  public: void add(Array<T> const &values, ArchInt i) {
+    if (i == -1) {
+      // Add any new items at the end of the values list.
+      ArchInt length = values.getLength();
+      if (length <= this->count) return;
+      this->_reserve(length);
+      while (this->count < length) {
+        this->_insert(this->count, this->hashFn(values.at(this->count)));
+        ++this->count;
+      }
+    } else if (i >= 0 && i < values.getLength()) {
+      // Add a new item at a specific location.
+      // First update the indices of the items that follow it, which the array already moved one position up. We go
+      // from the end so that no two slots have the same position at any time.
+      this->_reserve(this->count + 1);
+      for (ArchInt pos = this->count - 1; pos >= i; --pos) {
+        ++this->slots[this->_findHashedSlot(this->hashFn(values.at(pos + 1)), pos)].pos;
+      }
+      // Now insert the new value.
+      this->_insert(i, this->hashFn(values.at(i)));
+      ++this->count;
+    } else {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range"), i);
+    }
+  }
+
+  /// Remove the item at the given position. Must be called before the item is removed from the array.
+  public: void remove(Array<T> const &values, ArchInt i) {
+    if (i < 0 || i >= this->count) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range"), i);
+    }
+    this->_removeSlot(this->_findSlot(values, i));
+    // The array still has the items that follow the removed one at their old positions.
+    for (ArchInt pos = i + 1; pos < this->count; ++pos) {
+      --this->slots[this->_findHashedSlot(this->hashFn(values.at(pos)), pos)].pos;
+    }
+    --this->count;
+  }
+
+  /**
+   * @brief Remove the item at the given position and point the last item at that position.
+   * This must be called before the array is updated, and the caller must then move the last item of the array into
+   * the position of the removed item.
+   */
+  public: void removeAndMoveLast(Array<T> const &values, ArchInt i) {
+    if (i < 0 || i >= this->count) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range"), i);
+    }
+    ArchInt last = this->count - 1;
+    this->_removeSlot(this->_findSlot(values, i));
+    if (i != last) this->slots[this->_findSlot(values, last)].pos = i;
+    --this->count;
+  }
+
+  public: void clear() {
+    for (ArchInt s = 0; s < this->capacity; ++s) this->slots[s].pos = -1;
+    this->count = 0;
+  }
+
+  public: ArchInt findPos(Array<T> const &values, T const &v) const {
+    if (this->count == 0) return -1;
+    PtrWord h = this->hashFn(v);
+    for (ArchInt s = this->_getHome(h); this->slots[s].pos != -1; s = (s + 1) & (this->capacity - 1)) {
+      if (this->slots[s].hash == h && this->isEqualFn(values.at(this->slots[s].pos), v)) {
+        return this->slots[s].pos;
+      }
+    }
+    return -1;
+  }
+
+  private: ArchInt _getHome(PtrWord h) const {
+    return static_cast<ArchInt>(h & static_cast<PtrWord>(this->capacity - 1));
+  }
+
+  private: void _reserve(ArchInt size) {
+    // Keep the load factor at or below 3/4.
+    if (size * 4 <= this->capacity * 3) return;
+    ArchInt newCapacity = this->capacity == 0 ? 8 : this->capacity * 2;
+    while (size * 4 > newCapacity * 3) newCapacity *= 2;
+    HashIndexSlot *oldSlots = this->slots;
+    ArchInt oldCapacity = this->capacity;
+    this->slots = reinterpret_cast<HashIndexSlot*>(malloc(sizeof(HashIndexSlot) * newCapacity));
+    this->capacity = newCapacity;
+    for (ArchInt s = 0; s < newCapacity; ++s) this->slots[s].pos = -1;
+    if (oldSlots != 0) {
+      for (ArchInt s = 0; s < oldCapacity; ++s) {
+        if (oldSlots[s].pos != -1) this->_insert(oldSlots[s].pos, oldSlots[s].hash);
+      }
+      free(oldSlots);
+    }
+  }
+
+  private: void _insert(ArchInt pos, PtrWord h) {
+    ArchInt s = this->_getHome(h);
+    while (this->slots[s].pos != -1) s = (s + 1) & (this->capacity - 1);
+    this->slots[s].pos = pos;
+    this->slots[s].hash = h;
+  }
+
+  private: ArchInt _findSlot(Array<T> const &values, ArchInt pos) const {
+    return this->_findHashedSlot(this->hashFn(values.at(pos)), pos);
+  }
+
+  private: ArchInt _findHashedSlot(PtrWord h, ArchInt pos) const {
+    ArchInt s = this->_getHome(h);
+    while (this->slots[s].pos != pos) s = (s + 1) & (this->capacity - 1);
+    return s;
+  }
+
+  private: void _removeSlot(ArchInt hole) {
+    // Shift back the following slots of the same probe sequence so that lookups don't stop at the hole.
+    ArchInt mask = this->capacity - 1;
+    for (ArchInt s = (hole + 1) & mask; this->slots[s].pos != -1; s = (s + 1) & mask) {
+      ArchInt home = this->_getHome(this->slots[s].hash);
+      if (((s - home) & mask) >= ((s - hole) & mask)) {
+        this->slots[hole] = this->slots[s];
+        hole = s;
+      }
+    }
+    this->slots[hole].pos = -1;
+  }
+}; // class
+
+} // namespace
+
+#endif
@@ -0,0 +1,161 @@
+/**
+ * @file Srl/HashMap.h
+ * Contains the Srl::HashMap type.
+ *
+ * @copyright Copyright (C) 2021 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SRL_HASHMAP_H
+#define SRL_HASHMAP_H
+
+namespace Srl
+{
+
+/**
+ * @brief A map with O(1) amortized insertion, lookup and removal.
+ * @ingroup srl
+ *
+ * Items are kept in insertion order until an item is removed, at which point
+ * the last item is moved into the position of the removed one. Use a Map with
+ * an index when the order must be kept across removals.
+ */
+template<class T1, class T2> class HashMap {
+  //=================
+  // Member Variables
+
+  private: Array<T1> keys;
+  private: Array<T2> values;
+  private: HashIndex<T1> keysIndex;
+
+  //===============
+  // Initialization
+
+  public: HashMap() {
+  }
+
+  public: HashMap(PtrWord (*hashFn)(T1 const&), Bool (*isEqualFn)(T1 const&, T1 const&))
+    : keysIndex(hashFn, isEqualFn) {
+  }
+
+  public: HashMap(HashMap<T1, T2> const &map)
+    : keys(map.keys), values(map.values), keysIndex(map.keysIndex) {
+  }
+
+  //==========
+  // Operators
+
+  public: HashMap<T1, T2>& operator=(HashMap<T1, T2> const &map) {
+    this->keys = map.keys;
+    this->values = map.values;
+    this->keysIndex.assign(map.keysIndex);
+    return *this;
+  }
+
+  public: T2& operator()(T1 const &key) {
+    ArchInt i = this->findPos(key);
+    if (i == -1) {
+      i = this->keys.getLength();
+      this->keys.add(key);
+      this->values.add(T2());
+      this->keysIndex.add(this->keys, -1);
+    }
+    return this->values(i);
+  }
+
+  //=================
+  // Member Functions
+
+  public: T1 const& keyAt(ArchInt i) const {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    return this->keys(i);
+  }
+
+  public: T2& valAt(ArchInt i) {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    return this->values(i);
+  }
+
+  public: T2 const& valAt(ArchInt i) const {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    return this->values(i);
+  }
+
+  public: HashMap<T1, T2>& set(T1 const &key, T2 const &value) {
+    ArchInt pos = this->findPos(key);
+    if (pos == -1) {
+      this->keys.add(key);
+      this->values.add(value);
+      this->keysIndex.add(this->keys, -1);
+    } else {
+      this->values.set(pos, value);
+    }
+    return *this;
+  }
+
+  public: HashMap<T1, T2>& setAt(ArchInt i, T2 const &value) {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    this->values.set(i, value);
+    return *this;
+  }
+
+  public: Bool remove(T1 const &key) {
+    ArchInt pos = this->findPos(key);
+    if (pos == -1) return false;
+    this->removeAt(pos);
+    return true;
+  }
+
+  public: void removeAt(ArchInt i) {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    ArchInt last = this->keys.getLength() - 1;
+    this->keysIndex.removeAndMoveLast(this->keys, i);
+    if (i != last) {
+      this->keys.set(i, this->keys(last));
+      this->values.set(i, this->values(last));
+    }
+    this->keys.remove(last);
+    this->values.remove(last);
+  }
+
+  public: void clear() {
+    this->keys.clear();
+    this->values.clear();
+    this->keysIndex.clear();
+  }
+
+  public: ArchInt getLength() const {
+    return this->keys.getLength();
+  }
+
+  public: ArchInt findPos(T1 const &key) const {
+    return this->keysIndex.findPos(this->keys, key);
+  }
+
+  public: Array<T1> getKeys() const {
+    return this->keys;
+  }
+
+  public: Array<T2> getValues() const {
+    return this->values;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -22,7 +22,7 @@ template<class T1, class T2> class Map {
 
   private: Array<T1> keys;
   private: Array<T2> values;
-  private: ArrayIndex<T1> *keysIndex;
+  private: HashIndex<T1> *keysIndex;
 
   //===============
   // Initialization
@@ -31,7 +31,7 @@ template<class T1, class T2> class Map {
   }
 
   public: Map(Bool useIndex) {
-    if (useIndex) this->keysIndex = new ArrayIndex<T1>(&this->keys);
+    if (useIndex) this->keysIndex = new HashIndex<T1>();
     else this->keysIndex = 0;
   }
 
@@ -42,12 +42,14 @@ template<class T1, class T2> class Map {
   }
 
   public: Map(Map<T1, T2> const &map, Bool useIndex) {
-    this->Keys = map.keys;
+    this->keys = map.keys;
     this->values = map.values;
     if (useIndex) {
-      this->keysIndex = new ArrayIndex<T1>(&this->keys);
-      if (map.keysIndex != 0) this->keysIndex->indices = map.keysIndex->indices;
-      else this->keysIndex->add(-1);
+      if (map.keysIndex != 0) this->keysIndex = new HashIndex<T1>(*map.keysIndex);
+      else {
+        this->keysIndex = new HashIndex<T1>();
+        this->keysIndex->add(this->keys, -1);
+      }
     } else {
       this->keysIndex = 0;
     }
@@ -64,10 +66,10 @@ template<class T1, class T2> class Map {
     this->keys = map.keys;
     this->values = map.values;
     if (this->keysIndex != 0) {
-      if (map.keysIndex != 0) this->keysIndex->indices = map->keysIndex->indices;
+      if (map.keysIndex != 0) this->keysIndex->assign(*map.keysIndex);
       else {
         this->keysIndex->clear();
-        this->keysIndex->add(-1);
+        this->keysIndex->add(this->keys, -1);
       }
     }
     return *this;
@@ -79,7 +81,7 @@ template<class T1, class T2> class Map {
       i = this->keys.getLength();
       this->keys.add(key);
       this->values.add(T2());
-      if (this->keysIndex != 0) this->keysIndex->add(-1);
+      if (this->keysIndex != 0) this->keysIndex->add(this->keys, -1);
     }
     return this->values(i);
   }
@@ -113,7 +115,7 @@ template<class T1, class T2> class Map {
     if (pos == -1) {
       this->keys.add(key);
       this->values.add(value);
-      if (this->keysIndex != 0) this->keysIndex->add(-1);
+      if (this->keysIndex != 0) this->keysIndex->add(this->keys, -1);
     } else {
       this->values(pos) = value;
     }
@@ -131,7 +133,7 @@ template<class T1, class T2> class Map {
   public: void insert(ArchInt i, T1 const &key, T2 const &value) {
     this->keys.insert(i, key);
     this->values.insert(i, value);
-    if (this->keysIndex != 0) this->keysIndex->add(i);
+    if (this->keysIndex != 0) this->keysIndex->add(this->keys, i);
   }
 
   public: Bool remove(T1 const &key) {
@@ -145,9 +147,9 @@ template<class T1, class T2> class Map {
     if (i < 0 || i >= this->keys.getLength()) {
       throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
     }
+    if (this->keysIndex != 0) this->keysIndex->remove(this->keys, i);
     this->keys.remove(i);
     this->values.remove(i);
-    if (this->keysIndex != 0) this->keysIndex->remove(i);
   }
 
   public: void clear() {
@@ -164,7 +166,7 @@ template<class T1, class T2> class Map {
     if (this->keysIndex == 0) {
       return this->keys.findPos(key);
     } else {
-      return this->keysIndex->findPos(key);
+      return this->keysIndex->findPos(this->keys, key);
     }
   }
 
@@ -20,6 +20,7 @@
 #include <exception>
 #include <sstream>
 #include <cassert>
+#include <atomic>
 
 namespace Srl
 {
@@ -128,7 +129,9 @@ typedef unsigned long int PtrWord;
 #include "strs.h"
 #include "exceptions.h"
 #include "ArrayIndex.h"
+#include "HashIndex.h"
 #include "Map.h"
+#include "HashMap.h"
 
 // Since basic datatypes should be available everywhere, we'll just open up the namespace.
 using namespace Srl;
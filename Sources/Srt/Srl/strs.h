@@ -16,12 +16,23 @@
 namespace Srl
 {
 
+// The header that precedes the characters of a dynamically allocated string buffer. A length of -1 means the length
+// is unknown because the buffer was filled directly by the user, and will be computed on demand. The layout must
+// match Srl.StringHeader in String.alusus since strings are passed between C++ and Alusus; cpp_interop_test checks it.
+struct StringHeader
+{
+  ArchInt refCount;
+  ArchInt length;
+  ArchInt bufSize;
+};
+static_assert(sizeof(StringHeader) == 3 * sizeof(ArchInt), "StringHeader must match Srl.StringHeader.");
+
 template<class T> class StringBase
 {
   //=================
   // Member Variables
 
-  private: Int *refCount;
+  private: StringHeader *header;
   private: T *buf;
 
   //==========================
@@ -65,59 +76,93 @@ template<class T> class StringBase
   private: void _init() {
     static T strTerminator(0);
     this->buf = &strTerminator;
-    this->refCount = 0;
+    this->header = 0;
   }
 
-  private: void _alloc(LongInt length) {
-    this->refCount = (Int*)malloc(sizeof(Int) + sizeof(T) * (length + 1));
-    this->buf = (T*)((ArchInt)this->refCount + sizeof(*this->refCount));
-    *this->refCount = 1;
+  private: void _alloc(LongInt size) {
+    if (size < 0) size = 0;
+    this->header = (StringHeader*)malloc(sizeof(StringHeader) + sizeof(T) * (size + 1));
+    this->buf = (T*)(this->header + 1);
+    this->header->refCount = 1;
+    this->header->length = 0;
+    this->header->bufSize = size;
+    this->buf[0] = 0;
   }
 
-  private: void _realloc(LongInt newLength) {
-    this->refCount = (Int*)realloc(this->refCount, sizeof(Int) + sizeof(T) * (newLength + 1));
-    this->buf = (T*)((ArchInt)this->refCount + sizeof(*this->refCount));
+  private: void _realloc(LongInt newSize) {
+    this->header = (StringHeader*)realloc(this->header, sizeof(StringHeader) + sizeof(T) * (newSize + 1));
+    this->buf = (T*)(this->header + 1);
+    this->header->bufSize = newSize;
   }
 
   private: void _release() {
-    if (this->refCount != 0) {
-      --*this->refCount;
-      if (*this->refCount == 0) free(this->refCount);
+    if (this->header != 0) {
+      --this->header->refCount;
+      if (this->header->refCount == 0) free(this->header);
       this->_init();
     }
   }
 
   public: LongInt getLength() const {
-    return getLength(this->buf);
+    if (this->header == 0) return getLength(this->buf);
+    if (this->header->length < 0) this->header->length = getLength(this->buf);
+    return this->header->length;
+  }
+
+  public: LongInt getBufSize() const {
+    if (this->header == 0) return 0;
+    return this->header->bufSize;
   }
 
   public: void alloc(LongInt length) {
     this->_release();
     this->_alloc(length);
+    // The caller fills the buffer directly, so the length can only be known after that.
+    this->header->length = -1;
+  }
+
+  public: void reserve(LongInt size) {
+    LongInt length = this->getLength();
+    if (size < length) size = length;
+    if (this->header == 0 || this->header->refCount > 1) {
+      T *currentBuf = this->buf;
+      if (this->header != 0) --this->header->refCount;
+      this->_alloc(size);
+      copy(this->buf, currentBuf, length);
+      this->buf[length] = 0;
+      this->header->length = length;
+    } else if (size > this->header->bufSize) {
+      this->_realloc(size);
+    }
   }
 
   public: void assign(StringBase<T> const &str) {
+    if (str.header == this->header && str.buf == this->buf) return;
     this->_release();
-    this->refCount = str.refCount;
+    this->header = str.header;
     this->buf = str.buf;
-    if (this->refCount != 0) {
-      ++*this->refCount;
+    if (this->header != 0) {
+      ++this->header->refCount;
     }
   }
 
   public: void assign(T const *buf) {
-    this->_release();
-    if (buf != 0) {
-      this->_alloc(getLength(buf));
-      copy(this->buf, buf);
-    }
+    if (buf != 0) this->assign(buf, getLength(buf));
+    else this->_release();
   }
 
   public: void assign(T const *buf, LongInt n) {
+    n = getLength(buf, n);
     this->_release();
+    T const *staticBuf = getStaticBuf(buf, n);
+    if (staticBuf != 0) {
+      this->buf = const_cast<T*>(staticBuf);
+      return;
+    }
     this->_alloc(n);
     copy(this->buf, buf, n);
     this->buf[n] = 0;
+    this->header->length = n;
   }
 
   public: void append(T const *buf) {
@@ -125,29 +170,26 @@ template<class T> class StringBase
   }
 
   public: void append(T const *buf, LongInt n) {
-    auto bufLen = getLength(buf);
+    auto bufLen = getLength(buf, n);
     if (bufLen == 0) return;
     auto thisBufLen = this->getLength();
-    if (thisBufLen == 0) {
-      this->assign(buf, n);
+    if (thisBufLen == 0 && (this->header == 0 || this->header->refCount > 1)) {
+      // There is no buffer of our own to append to, so we might as well take a static buffer if one fits. A buffer
+      // set up by reserve() is appended to in place like any other.
+      this->assign(buf, bufLen);
       return;
     }
     LongInt newLength = thisBufLen + bufLen;
-    if (this->refCount == 0) {
-      T *currentBuf = this->buf;
-      this->_alloc(newLength);
-      copy(this->buf, currentBuf);
-      concat(this->buf, buf, n);
-    } else if (*this->refCount > 1) {
-      T *currentBuf = this->buf;
-      --*this->refCount;
-      this->_alloc(newLength);
-      copy(this->buf, currentBuf);
-      concat(this->buf, buf, n);
-    } else {
-      this->_realloc(newLength);
-      concat(this->buf, buf, n);
+    if (this->header == 0 || this->header->refCount > 1) {
+      this->reserve(newLength);
+    } else if (newLength > this->header->bufSize) {
+      // Grow geometrically to keep repeated appends linear.
+      LongInt newSize = this->header->bufSize + (this->header->bufSize >> 1);
+      this->_realloc(newSize > newLength ? newSize : newLength);
     }
+    copy(this->buf + thisBufLen, buf, bufLen);
+    this->buf[newLength] = 0;
+    this->header->length = newLength;
   }
 
   public: void append(T c) {
@@ -193,9 +235,9 @@ template<class T> class StringBase
   }
 
   public: LongInt find(LongInt startPos, T const *buf) const {
-    T *startBuf = this->buf;
-    while (*startBuf != 0 && startPos > 0) { --startPos; ++startBuf; }
-    if (startPos > 0) return -1;
+    if (startPos < 0) startPos = 0;
+    else if (startPos > this->getLength()) return -1;
+    T *startBuf = this->buf + startPos;
     void const *pos = find(startBuf, buf);
     if (pos == 0) return -1;
     return (ArchInt)pos - (ArchInt)this->buf;
@@ -213,9 +255,9 @@ template<class T> class StringBase
   }
 
   public: LongInt find(LongInt startPos, T c) const {
-    T *startBuf = this->buf;
-    while (*startBuf != 0 && startPos > 0) { --startPos; ++startBuf; }
-    if (startPos > 0) return -1;
+    if (startPos < 0) startPos = 0;
+    else if (startPos > this->getLength()) return -1;
+    T *startBuf = this->buf + startPos;
     void const *pos = find(startBuf, c);
     if (pos == 0) return -1;
     return (ArchInt)pos - (ArchInt)this->buf;
@@ -351,6 +393,14 @@ template<class T> class StringBase
     return this->buf;
   }
 
+  // Returns a buffer that can be modified in place. The buffer is copied first if it's shared with other strings or
+  // is a read only static buffer, and the length is recomputed on demand afterwards since the caller may change it.
+  public: T* getWritableBuf() {
+    this->reserve(this->getLength());
+    this->header->length = -1;
+    return this->buf;
+  }
+
   //==========
   // Operators
 
@@ -494,6 +544,72 @@ template<class T> class StringBase
 
   public: static LongInt getLength(T const *s);
 
+  public: static LongInt getLength(T const *s, LongInt n);
+
+  // Returns a static buffer holding the given string if it's short enough, or 0 otherwise, so that strings holding
+  // most tokens don't need a heap allocation. Static buffers are shared and, for empty strings and single characters,
+  // read only, so they must not be written to; getWritableBuf copies them first.
+  public: static T const* getStaticBuf(T const *buf, LongInt length)
+  {
+    static constexpr SingleBufs singleBufs{};
+    if (length == 0) return &singleBufs.bufs[0][0];
+    if (length == 1) {
+      Word c = buf[0];
+      if (c >= 128) return 0;
+      return &singleBufs.bufs[c][0];
+    }
+    if (length > 3) return 0;
+    return getShortBuf(buf, length);
+  }
+
+  // Strings of two or three characters are kept in a fixed size table that is filled as they are first seen. A string
+  // mapping to a slot taken by another string gets allocated normally, so the table stays bounded no matter how many
+  // distinct short strings there are, and no list of common strings is needed.
+  private: static T const* getShortBuf(T const *buf, LongInt length)
+  {
+    static ShortBufs shortBufs;
+    Word c1 = buf[0];
+    Word c2 = buf[1];
+    Word c3 = length == 3 ? buf[2] : 0;
+    Word hash = (c1 * 0x9E3779B1u) ^ (c2 * 0x85EBCA77u) ^ (c3 * 0xC2B2AE3Du);
+    Word index = (hash ^ (hash >> 16)) % ShortBufs::slotCount;
+    T *slot = shortBufs.bufs[index];
+    auto &state = shortBufs.states[index];
+    Word currentState = state.load(std::memory_order_acquire);
+    if (currentState == ShortBufs::EMPTY) {
+      // Claim the slot before filling it so that no other thread reads it half filled.
+      if (!state.compare_exchange_strong(currentState, ShortBufs::FILLING, std::memory_order_relaxed)) return 0;
+      slot[0] = c1;
+      slot[1] = c2;
+      slot[2] = c3;
+      slot[3] = 0;
+      state.store(ShortBufs::READY, std::memory_order_release);
+      return slot;
+    } else if (currentState == ShortBufs::READY && slot[0] == c1 && slot[1] == c2 && slot[2] == c3) {
+      return slot;
+    } else {
+      return 0;
+    }
+  }
+
+  private: struct SingleBufs {
+    T bufs[128][2];
+
+    constexpr SingleBufs() : bufs() {
+      for (Word i = 0; i < 128; ++i) this->bufs[i][0] = i;
+    }
+  };
+
+  // Zero initialized, so all slots start empty without any dynamic initialization.
+  private: struct ShortBufs {
+    static constexpr Word slotCount = 2048;
+    static constexpr Word EMPTY = 0;
+    static constexpr Word FILLING = 1;
+    static constexpr Word READY = 2;
+    std::atomic<Word> states[slotCount];
+    T bufs[slotCount][4];
+  };
+
   public: static T toUpper(T c);
 
   public: static T toLower(T c);
@@ -602,6 +718,13 @@ template<> inline LongInt StringBase<WChar>::getLength(WChar const *s) {
   return wcslen(s);
 }
 
+template<> inline LongInt StringBase<Char>::getLength(Char const *s, LongInt n) {
+  return strnlen(s, n);
+}
+template<> inline LongInt StringBase<WChar>::getLength(WChar const *s, LongInt n) {
+  return wcsnlen(s, n);
+}
+
 template<> inline Char StringBase<Char>::toUpper(Char c) {
   return toupper(c);
 }
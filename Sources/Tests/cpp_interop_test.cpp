@@ -50,6 +50,21 @@ DL_EXPORTED void printTestString(String str) {
   outStream << str << "\n";
 }
 
+DL_EXPORTED void printTestStringInfo(String str) {
+  outStream << str << ", length: " << str.getLength() << ", buf size: " << str.getBufSize() << "\n";
+}
+
+// Returns the offsets of the fields of StringHeader followed by its size, to be compared against the layout of the
+// Alusus StringHeader.
+DL_EXPORTED ArchInt getTestStringHeaderLayout(Int field) {
+  switch (field) {
+    case 0: return offsetof(StringHeader, refCount);
+    case 1: return offsetof(StringHeader, length);
+    case 2: return offsetof(StringHeader, bufSize);
+    default: return sizeof(StringHeader);
+  }
+}
+
 DL_EXPORTED Map<String, String> getTestMap() {
   Map<String, String> map;
   map("name") = String("Mohammed");
@@ -30,6 +30,15 @@ namespace Tests
 
 Str resultFilename;
 
+/// Whether the lexer should use its compiled DFA rather than interpret the grammar.
+Bool lexerDfaEnabled = true;
+
+/// The directory of the parse cache to use, or an empty string to disable the parse cache.
+Str parseCacheDir;
+
+/// Whether cached parse results are verified against a fresh parse.
+Bool parseCacheVerifying = false;
+
 /**
  * @brief Print the provided notices to the console.
  *
@@ -77,6 +86,40 @@ Bool isDirectory(Char const *path)
 }
 
 
+void removeDirectory(Str const &dirPath)
+{
+  DIR *dir;
+  dirent *ent;
+  if ((dir = opendir(dirPath)) != nullptr) {
+    while ((ent = readdir(dir)) != nullptr) {
+      Str fileName(ent->d_name);
+      if (fileName != "." && fileName != "..") std::remove(dirPath + "/" + fileName);
+    }
+    closedir(dir);
+  }
+  rmdir(dirPath);
+}
+
+
+/// Get the modification times, in nanoseconds, of the files in the given directory keyed by filename.
+std::map<std::string, LongInt> getModificationTimes(Str const &dirPath)
+{
+  std::map<std::string, LongInt> times;
+  DIR *dir;
+  dirent *ent;
+  if ((dir = opendir(dirPath)) != nullptr) {
+    while ((ent = readdir(dir)) != nullptr) {
+      Str fileName(ent->d_name);
+      struct stat fileStat;
+      if (fileName == "." || fileName == ".." || stat(dirPath + "/" + fileName, &fileStat) != 0) continue;
+      times[ent->d_name] = (LongInt)fileStat.st_mtim.tv_sec * 1000000000 + fileStat.st_mtim.tv_nsec;
+    }
+    closedir(dir);
+  }
+  return times;
+}
+
+
 Bool compareStringEnd(Str const &str, Char const *end)
 {
   Int len = getStrLen(end);
@@ -105,6 +148,12 @@ Bool runSourceFile(Str const &fileName)
   {
     // Prepare the root object;
     RootManager root;
+    root.setLexerDfaEnabled(lexerDfaEnabled);
+    if (parseCacheDir.getLength() > 0) {
+      root.getParseCache()->setDirectory(parseCacheDir);
+      root.getParseCache()->setEnabled(true);
+      root.getParseCache()->setVerifying(parseCacheVerifying);
+    }
     Slot<void, SharedPtr<Core::Notices::Notice> const&> noticeSlot(printNotice);
     root.noticeSignal.connect(noticeSlot);
 
@@ -304,7 +353,81 @@ int main(int argc, char **argv)
 
   auto ret = EXIT_SUCCESS;
   if (!runEndToEndTests("./Core")) ret = EXIT_FAILURE;
+
+  // The interpreting lexer must produce the same results as the compiled DFA.
+  std::cout << "\nRunning Core tests with the interpreting lexer.\n";
+  lexerDfaEnabled = false;
+  if (!runEndToEndTests("./Core")) ret = EXIT_FAILURE;
+  lexerDfaEnabled = true;
+
+  // Parse results replayed from the parse cache must produce the same results as parsing. The
+  // first run fills the cache, the second replays it, and the third verifies it against a fresh
+  // parse.
+  parseCacheDir = tempPath;
+  if (parseCacheDir(parseCacheDir.getLength() - 1) != '/') parseCacheDir += "/";
+  parseCacheDir += "AlususEndToEndTestParseCache";
+  removeDirectory(parseCacheDir);
+  std::cout << "\nRunning Core tests with the parse cache.\n";
+  if (!runEndToEndTests("./Core")) ret = EXIT_FAILURE;
+  std::cout << "\nRunning Core tests replaying the parse cache.\n";
+  if (!runEndToEndTests("./Core")) ret = EXIT_FAILURE;
+  std::cout << "\nRunning Core tests verifying the parse cache.\n";
+  parseCacheVerifying = true;
+  if (!runEndToEndTests("./Core")) ret = EXIT_FAILURE;
+  parseCacheVerifying = false;
+  removeDirectory(parseCacheDir);
+  parseCacheDir = "";
+
   if (!runEndToEndTests("./Spp")) ret = EXIT_FAILURE;
+
+  // JIT results must not depend on the number of compile threads. Compile threads are opt-in, so the
+  // tests are run again with multiple threads, each compiling modules in their own contexts, and a
+  // malformed count falls back to the default.
+  Str jitThreads = getenv("ALUSUS_JIT_THREADS") == 0 ? "" : getenv("ALUSUS_JIT_THREADS");
+  std::cout << "\nRunning Spp tests with multiple compile threads.\n";
+  setenv("ALUSUS_JIT_THREADS", "4", 1);
+  if (!runEndToEndTests("./Spp/Running")) ret = EXIT_FAILURE;
+  std::cout << "\nRunning Spp tests with a malformed JIT thread count.\n";
+  setenv("ALUSUS_JIT_THREADS", "abc", 1);
+  if (!runEndToEndTests("./Spp/Running")) ret = EXIT_FAILURE;
+  if (jitThreads.getLength() > 0) setenv("ALUSUS_JIT_THREADS", jitThreads, 1);
+  else unsetenv("ALUSUS_JIT_THREADS");
+
+  // Objects loaded from the JIT object cache must behave the same as freshly compiled ones. The first
+  // run fills the cache with a malformed limit that falls back to the default, and the second run
+  // links the objects from the cache with a 1 MB limit to exercise eviction during the run. Loading
+  // an object refreshes its modification time, which is how the second run is checked to have
+  // actually loaded objects from the cache rather than compiling everything again.
+  Str jitCacheDir = tempPath;
+  if (jitCacheDir(jitCacheDir.getLength() - 1) != '/') jitCacheDir += "/";
+  jitCacheDir += "AlususEndToEndTestJitCache";
+  removeDirectory(jitCacheDir);
+  setenv("ALUSUS_JIT_CACHE", "1", 1);
+  setenv("ALUSUS_JIT_CACHE_DIR", jitCacheDir, 1);
+  setenv("ALUSUS_JIT_CACHE_SIZE", "abc", 1);
+  std::cout << "\nRunning Spp tests with the JIT object cache.\n";
+  if (!runEndToEndTests("./Spp/Running")) ret = EXIT_FAILURE;
+  auto cachedTimes = getModificationTimes(jitCacheDir);
+  std::cout << "\nRunning Spp tests replaying the JIT object cache.\n";
+  setenv("ALUSUS_JIT_CACHE_SIZE", "1", 1);
+  if (!runEndToEndTests("./Spp/Running")) ret = EXIT_FAILURE;
+  Int loadedCount = 0;
+  for (auto const &entry : getModificationTimes(jitCacheDir)) {
+    auto cachedEntry = cachedTimes.find(entry.first);
+    if (cachedEntry != cachedTimes.end() && entry.second > cachedEntry->second) ++loadedCount;
+  }
+  std::cout << ">>> Checking objects loaded from the JIT object cache: ";
+  if (loadedCount > 0) {
+    std::cout << "Successful." << std::endl;
+  } else {
+    std::cout << "Failed. No objects were loaded from the cache." << std::endl;
+    ret = EXIT_FAILURE;
+  }
+  unsetenv("ALUSUS_JIT_CACHE");
+  unsetenv("ALUSUS_JIT_CACHE_DIR");
+  unsetenv("ALUSUS_JIT_CACHE_SIZE");
+  removeDirectory(jitCacheDir);
+
   if (!runEndToEndTests("./Srt")) ret = EXIT_FAILURE;
 
   Str l18nPath = Core::Main::getModuleDirectory();
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""
+Counts the heap allocations made while lexing and parsing the sources of the
+standard runtime library (Sources/Srt/Srl/*.alusus), optionally comparing the
+counts against a baseline build of Alusus.
+
+Usage: alloc_benchmark.py <path to alusus executable> [--baseline <path to alusus executable>]
+
+Allocations are counted using valgrind, which needs to be installed. Loading
+the Spp library and initializing LLVM allocate a lot on their own, so the
+allocations of a run that only imports the Spp library are subtracted from the
+count of each source. The Srl sources only hold definitions, which aren't
+compiled unless used, so what remains is mostly lexing and parsing.
+"""
+from __future__ import print_function
+import argparse
+import os
+import re
+import subprocess
+import tempfile
+
+ALUSUS_ROOT = os.path.dirname(os.path.dirname(os.path.realpath(__file__)))
+SRL_PATH = os.path.join(ALUSUS_ROOT, "Sources", "Srt", "Srl")
+HEAP_USAGE_REGEX = re.compile(r"total heap usage: ([\d,]+) allocs, [\d,]+ frees, ([\d,]+) bytes allocated")
+
+
+def find_sources():
+    return [os.path.join(SRL_PATH, filename) for filename in sorted(os.listdir(SRL_PATH))
+            if filename.endswith(".alusus")]
+
+
+def count_process_allocs(alusus, source):
+    result = subprocess.run(["valgrind", "--leak-check=no", alusus, source], cwd=SRL_PATH,
+                            stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, universal_newlines=True)
+    match = HEAP_USAGE_REGEX.search(result.stderr)
+    if match is None:
+        return None
+    return int(match.group(1).replace(",", "")), int(match.group(2).replace(",", ""))
+
+
+def count_startup_allocs(alusus):
+    with tempfile.NamedTemporaryFile("w", suffix=".alusus", delete=False) as stub:
+        stub.write('import "alusus_spp";\n')
+    try:
+        return count_process_allocs(alusus, stub.name)
+    finally:
+        os.remove(stub.name)
+
+
+def count_allocs(alusus, source, startup):
+    result = count_process_allocs(alusus, source)
+    if result is None:
+        return None
+    return result[0] - startup[0], result[1] - startup[1]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Count heap allocations made while lexing and parsing Srl sources.")
+    parser.add_argument("alusus", help="Path to the alusus executable.")
+    parser.add_argument("--baseline", help="Path to an alusus executable to compare against.")
+    args = parser.parse_args()
+
+    builds = [("", args.alusus)]
+    if args.baseline:
+        builds.insert(0, ("base ", args.baseline))
+    startups = [count_startup_allocs(alusus) for _, alusus in builds]
+    if None in startups:
+        print("Failed to run alusus under valgrind.")
+        return
+    totals = [[0, 0] for _ in builds]
+    print("{:<24}".format("source") + "".join("{:>16}{:>16}".format(name + "allocs", name + "bytes")
+                                              for name, _ in builds))
+    for source in find_sources():
+        results = [count_allocs(alusus, source, startup) for (_, alusus), startup in zip(builds, startups)]
+        if None in results:
+            continue
+        for total, (allocs, size) in zip(totals, results):
+            total[0] += allocs
+            total[1] += size
+        print("{:<24}".format(os.path.basename(source)) +
+              "".join("{:>16}{:>16}".format(allocs, size) for allocs, size in results))
+    print("{:<24}".format("total") + "".join("{:>16}{:>16}".format(allocs, size) for allocs, size in totals))
+    if args.baseline and totals[0][0] > 0:
+        print("allocation count change: {:+.1f}%".format(100.0 * (totals[1][0] - totals[0][0]) / totals[0][0]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""
+Compares the binary size and run time of executables built from the tests in
+Sources/Tests/Spp/Running using each of the LTO modes of offline builds.
+
+Usage: lto_benchmark.py <path to alusus executable> [--opt-level N] [--runs N]
+
+Thin LTO requires lld to be installed since the linker is the one generating
+the code in that mode. Without lld, Build falls back to full LTO, so the thin
+mode is left out of the comparison.
+"""
+from __future__ import print_function
+import argparse
+import os
+import shutil
+import subprocess
+import tempfile
+import time
+
+ALUSUS_ROOT = os.path.dirname(os.path.dirname(os.path.realpath(__file__)))
+TESTS_PATH = os.path.join(ALUSUS_ROOT, "Sources", "Tests", "Spp", "Running")
+LTO_MODES = [("none", "Spp.LtoMode.NONE"), ("full", "Spp.LtoMode.FULL"), ("thin", "Spp.LtoMode.THIN")]
+
+WRAPPER_TEMPLATE = """
+import "{test}";
+import "Build.alusus";
+
+@expname[main] function main {{
+  Main.start();
+}};
+
+def exe: Build.Exe(main~ast, "{output}");
+exe.setOptimizationLevel({optLevel});
+exe.setLtoMode({ltoMode});
+exe.generate();
+"""
+
+
+def find_tests():
+    tests = []
+    for filename in sorted(os.listdir(TESTS_PATH)):
+        if not filename.endswith("_test.alusus"):
+            continue
+        path = os.path.join(TESTS_PATH, filename)
+        with open(path) as f:
+            if "Main.start();" in f.read():
+                tests.append(path)
+    return tests
+
+
+def build(alusus, test, output, opt_level, lto_mode, work_dir):
+    wrapper = os.path.join(work_dir, "wrapper.alusus")
+    with open(wrapper, "w") as f:
+        f.write(WRAPPER_TEMPLATE.format(test=test, output=output, optLevel=opt_level, ltoMode=lto_mode))
+    if os.path.exists(output):
+        os.remove(output)
+    subprocess.run([alusus, wrapper], cwd=os.path.dirname(test), stdout=subprocess.DEVNULL,
+                   stderr=subprocess.DEVNULL)
+    return os.path.exists(output)
+
+
+def measure(output, runs):
+    start = time.perf_counter()
+    for _ in range(runs):
+        subprocess.run([output], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return (time.perf_counter() - start) / runs
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark LTO modes of offline builds.")
+    parser.add_argument("alusus", help="Path to the alusus executable.")
+    parser.add_argument("--opt-level", type=int, default=2, help="Optimization level of the builds.")
+    parser.add_argument("--runs", type=int, default=20, help="Number of runs used to measure run time.")
+    args = parser.parse_args()
+
+    lto_modes = LTO_MODES
+    if shutil.which("ld.lld") is None:
+        print("lld was not found; skipping thin LTO.")
+        lto_modes = [(mode, lto_mode) for mode, lto_mode in LTO_MODES if mode != "thin"]
+
+    work_dir = tempfile.mkdtemp(prefix="alusus_lto_")
+    totals = {mode: [0, 0.0] for mode, _ in lto_modes}
+    print("{:<40}".format("test") + "".join("{:>12}{:>12}".format(mode + " size", mode + " ms")
+                                             for mode, _ in lto_modes))
+    try:
+        for test in find_tests():
+            results = []
+            for mode, lto_mode in lto_modes:
+                output = os.path.join(work_dir, "output_" + mode)
+                if not build(args.alusus, test, output, args.opt_level, lto_mode, work_dir):
+                    break
+                results.append((mode, os.path.getsize(output), measure(output, args.runs) * 1000))
+            if len(results) != len(lto_modes):
+                # Tests that can't be built into an executable, like those expecting build errors.
+                continue
+            for mode, size, duration in results:
+                totals[mode][0] += size
+                totals[mode][1] += duration
+            print("{:<40}".format(os.path.basename(test)) +
+                  "".join("{:>12}{:>12.3f}".format(size, duration) for _, size, duration in results))
+        print("{:<40}".format("total") +
+              "".join("{:>12}{:>12.3f}".format(totals[mode][0], totals[mode][1]) for mode, _ in lto_modes))
+    finally:
+        shutil.rmtree(work_dir)
+
+
+if __name__ == "__main__":
+    main()